@@ -0,0 +1,196 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ArchiveSession.h
+///  \brief         Contains the ArchiveSession object
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 09:12:37
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/Serialization.h>
+
+#include <boost/archive/basic_archive.hpp>
+
+#include <exception>
+#include <optional>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ArchiveSession
+///  \brief         Creates an archive once (without a header) and uses it to
+///                 serialize or deserialize many independent messages, which
+///                 avoids the cost of creating an archive (and writing its
+///                 header) for every message.
+///
+///                 Example:
+///                     ArchiveSession<boost::archive::binary_oarchive>     out_session(out);
+///
+///                     obj1.Serialize(out_session);
+///                     obj2.Serialize(out_session);
+///
+///                     ArchiveSession<boost::archive::binary_iarchive>     in_session(in);
+///
+///                     MyObj const                                         new_obj1(MyObj::Deserialize(in_session));
+///                     MyObj const                                         new_obj2(MyObj::Deserialize(in_session));
+///
+///                 Boost archives write information about tracked objects and
+///                 classes once per archive, which would make a message depend
+///                 on the ones that came before it. To keep messages independent,
+///                 the archive is recreated after any message whose type may add
+///                 this state to the archive (see Details::IsArchiveStatelessMember);
+///                 the archive is reused for messages made up of fundamental types,
+///                 enums, strings, and SERIALIZATION types with those members.
+///                 Because this decision is based on the message type, sessions
+///                 used to serialize and deserialize remain in sync.
+///
+template <typename ArchiveT>
+class ArchiveSession {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using Archive                           = ArchiveT;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         Message
+    ///  \brief         Provides access to the archive while a message of type
+    ///                 T is serialized or deserialized, and resets the session
+    ///                 when the message is complete (if necessary).
+    ///
+    template <typename T>
+    class Message {
+    public:
+        // ----------------------------------------------------------------------
+        // |  Public Methods
+        Message(ArchiveSession &session);
+        ~Message(void);
+
+        Message(Message const &) = delete;
+        Message & operator =(Message const &) = delete;
+
+        ArchiveT & GetArchive(void) const;
+
+    private:
+        // ----------------------------------------------------------------------
+        // |  Private Data
+        ArchiveSession &                    _session;
+        int const                           _numUncaughtExceptions;
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    template <typename StreamT>
+    ArchiveSession(StreamT &stream, unsigned int flags=0);
+
+    ArchiveSession(ArchiveSession const &) = delete;
+    ArchiveSession & operator =(ArchiveSession const &) = delete;
+
+    ArchiveT & GetArchive(void);
+
+    /// Called by the Serialize and Deserialize methods generated by SERIALIZATION.
+    template <typename T>
+    Message<T> BeginMessage(void);
+
+    /// Recreates the archive, discarding all tracking and class information.
+    void Reset(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    using CreateArchiveFunc                 = void (*)(std::optional<ArchiveT> &archive, void *pStream, unsigned int flags);
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    void * const                            _pStream;
+    unsigned int const                      _flags;
+    CreateArchiveFunc const                 _createArchiveFunc;
+
+    std::optional<ArchiveT>                 _archive;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename ArchiveT>
+template <typename StreamT>
+ArchiveSession<ArchiveT>::ArchiveSession(StreamT &stream, unsigned int flags) :
+    _pStream(&stream),
+    _flags(flags | boost::archive::no_header),
+    _createArchiveFunc(
+        [](std::optional<ArchiveT> &archive, void *pStream, unsigned int flags) {
+            archive.emplace(*static_cast<StreamT *>(pStream), flags);
+        }
+    )
+{
+    _createArchiveFunc(_archive, _pStream, _flags);
+}
+
+template <typename ArchiveT>
+ArchiveT & ArchiveSession<ArchiveT>::GetArchive(void) {
+    return *_archive;
+}
+
+template <typename ArchiveT>
+template <typename T>
+typename ArchiveSession<ArchiveT>::template Message<T> ArchiveSession<ArchiveT>::BeginMessage(void) {
+    return Message<T>(*this);
+}
+
+template <typename ArchiveT>
+void ArchiveSession<ArchiveT>::Reset(void) {
+    // Destroy the current archive before creating the new one, as some archives
+    // write to the stream when they are destroyed.
+    _archive.reset();
+    _createArchiveFunc(_archive, _pStream, _flags);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename ArchiveT>
+template <typename T>
+ArchiveSession<ArchiveT>::Message<T>::Message(ArchiveSession &session) :
+    _session(session),
+    _numUncaughtExceptions(std::uncaught_exceptions())
+{}
+
+template <typename ArchiveT>
+template <typename T>
+ArchiveSession<ArchiveT>::Message<T>::~Message(void) {
+    // The state of the archive is unknown if an exception was thrown
+    if(
+        Details::IsArchiveStatelessMember<T>() == false
+        || std::uncaught_exceptions() != _numUncaughtExceptions
+    )
+        _session.Reset();
+}
+
+template <typename ArchiveT>
+template <typename T>
+ArchiveT & ArchiveSession<ArchiveT>::Message<T>::GetArchive(void) const {
+    return _session.GetArchive();
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
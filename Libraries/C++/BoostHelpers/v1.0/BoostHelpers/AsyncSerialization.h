@@ -0,0 +1,302 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AsyncSerialization.h
+///  \brief         Contains the SerializeAsync function
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 23:41:09
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/Serialization.h>
+
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <queue>
+#include <stdexcept>
+#include <streambuf>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+/// Size of the chunks written by SerializeAsync when a chunk size isn't provided
+constexpr size_t const DefaultAsyncChunkSize = 1024 * 1024;
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PipelinedOutputBuffer
+///  \brief         Stream buffer that writes its content to a stream in chunks
+///                 of a fixed size. The chunks are filled by the caller and
+///                 written to the stream by a writer thread that lives as long
+///                 as the buffer; at most NumChunks - 1 chunks are queued for
+///                 the writer, after which the caller waits for a chunk to
+///                 become available.
+///
+class PipelinedOutputBuffer : public std::streambuf {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    static constexpr size_t const           NumChunks = 2;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    PipelinedOutputBuffer(std::ostream &s, size_t chunkSize) :
+        _s(s) {
+        if(chunkSize == 0)
+            throw std::invalid_argument("chunkSize");
+
+        for(std::vector<char> &chunk : _chunks)
+            chunk.resize(chunkSize);
+
+        SetChunk();
+
+        _writer = std::thread([this](void) { Write(); });
+    }
+
+    ~PipelinedOutputBuffer(void) override {
+        // Queued writes refer to the chunks
+        {
+            std::unique_lock<std::mutex>    lock(_mutex);
+
+            _done = true;
+        }
+
+        _cv.notify_all();
+        _writer.join();
+    }
+
+    PipelinedOutputBuffer(PipelinedOutputBuffer const &) = delete;
+    PipelinedOutputBuffer & operator =(PipelinedOutputBuffer const &) = delete;
+
+    /// Writes the remaining content and waits for all writes to complete.
+    void Finish(void) {
+        Submit();
+
+        {
+            std::unique_lock<std::mutex>    lock(_mutex);
+
+            _cv.wait(lock, [this](void) { return _numPending == 0; });
+            RethrowError();
+        }
+
+        if(!_s.flush())
+            throw std::runtime_error("The content could not be written");
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        Submit();
+
+        if(traits_type::eq_int_type(c, traits_type::eof()) == false) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+
+        return traits_type::not_eof(c);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    struct PendingWrite {
+        char const *                        data;
+        std::streamsize                     size;
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::ostream &                          _s;
+
+    std::vector<char>                       _chunks[NumChunks];
+    size_t                                  _chunkIndex = 0;
+
+    std::mutex                              _mutex;
+    std::condition_variable                 _cv;
+    std::queue<PendingWrite>                _queue;
+    size_t                                  _numPending = 0; // Queued or being written
+    std::exception_ptr                      _pError;
+    bool                                    _done = false;
+
+    std::thread                             _writer;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    void SetChunk(void) {
+        std::vector<char> &                 chunk(_chunks[_chunkIndex]);
+
+        setp(chunk.data(), chunk.data() + chunk.size());
+    }
+
+    void Submit(void) {
+        std::streamsize const               size(pptr() - pbase());
+
+        if(size == 0)
+            return;
+
+        {
+            std::unique_lock<std::mutex>    lock(_mutex);
+
+            // Chunks are used in order, so the next chunk is available once
+            // fewer than NumChunks - 1 writes are pending.
+            _cv.wait(lock, [this](void) { return _numPending < NumChunks - 1 || _pError; });
+            RethrowError();
+
+            _queue.push(PendingWrite{ pbase(), size });
+            ++_numPending;
+        }
+
+        _cv.notify_all();
+
+        _chunkIndex = (_chunkIndex + 1) % NumChunks;
+        SetChunk();
+    }
+
+    void RethrowError(void) const {
+        if(_pError)
+            std::rethrow_exception(_pError);
+    }
+
+    void Write(void) {
+        std::unique_lock<std::mutex>        lock(_mutex);
+
+        while(true) {
+            _cv.wait(lock, [this](void) { return _queue.empty() == false || _done; });
+
+            if(_queue.empty())
+                break;
+
+            PendingWrite const              write(_queue.front());
+
+            _queue.pop();
+
+            // Content isn't written once an error has been encountered
+            if(!_pError) {
+                lock.unlock();
+
+                std::exception_ptr          pError;
+
+                try {
+                    if(!_s.write(write.data, write.size))
+                        throw std::runtime_error("The content could not be written");
+                }
+                catch(...) {
+                    pError = std::current_exception();
+                }
+
+                lock.lock();
+
+                if(pError)
+                    _pError = pError;
+            }
+
+            --_numPending;
+            _cv.notify_all();
+        }
+    }
+};
+
+template <typename ArchiveT, typename T, typename OwnerT>
+std::future<void> SerializeAsyncImpl(std::ostream &s, T const &obj, size_t chunkSize, OwnerT owner) {
+    static_assert(has_SerializationPOD<T>, "SerializeAsync is only available for types generated by SERIALIZATION");
+
+    if(chunkSize == 0)
+        throw std::invalid_argument("chunkSize");
+
+    typename T::SerializationPOD::SerializeData const   data(obj);
+
+    return std::async(
+        std::launch::async,
+        [&s, data, chunkSize, owner = std::move(owner)](void) mutable {
+            {
+                PipelinedOutputBuffer       buffer(s, chunkSize);
+
+                {
+                    std::ostream            out(&buffer);
+                    ArchiveT                ar(out);
+
+                    SaveNamed(ar, T::SerializationSchema::TypeName, data);
+                }
+
+                buffer.Finish();
+            }
+
+            // Release the object (if owned) once it has been written
+            owner = OwnerT();
+        }
+    );
+}
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SerializeAsync
+///  \brief         Serializes an object generated by SERIALIZATION on a
+///                 different thread, returning a future that is ready once all
+///                 of the content has been written to the stream; exceptions
+///                 encountered while serializing are provided by the future.
+///                 The content written is the same as that written by
+///                 `obj.Serialize<ArchiveT>(s)`.
+///
+///                 The SerializeData view of the object is created before this
+///                 function returns and the archive's output is written in
+///                 chunks of `chunkSize` bytes, where the encoding of a chunk
+///                 overlaps the write of the previous one.
+///
+///                 The view refers to the object's members rather than copies
+///                 of them, as copying would cost as much as the serialization
+///                 itself. The object must remain valid and must NOT BE MODIFIED
+///                 until the future is ready (modifying it before then is a data
+///                 race with the background task), and the stream must remain
+///                 valid and must not be used during this time. Objects that
+///                 won't be used once they are written (for example, outbound
+///                 messages) can be moved into the function instead, in which
+///                 case the object is owned (and destroyed) by the background
+///                 task and the caller is free to continue.
+///
+///                 Example:
+///                     std::future<void>                                   result(SerializeAsync<boost::archive::binary_oarchive>(out, obj));
+///                     std::future<void>                                   consumed(SerializeAsync<boost::archive::binary_oarchive>(other_out, std::move(other_obj)));
+///
+///                     // ...
+///
+///                     result.get();
+///                     consumed.get();
+///
+template <typename ArchiveT, typename T>
+std::future<void> SerializeAsync(std::ostream &s, T const &obj, size_t chunkSize=DefaultAsyncChunkSize) {
+    return Details::SerializeAsyncImpl<ArchiveT>(s, obj, chunkSize, nullptr);
+}
+
+template <typename ArchiveT, typename T, typename EnableIfT=std::enable_if_t<std::is_lvalue_reference_v<T> == false>>
+std::future<void> SerializeAsync(std::ostream &s, T &&obj, size_t chunkSize=DefaultAsyncChunkSize) {
+    // The object is moved to the heap so that the view remains valid when
+    // the owner is moved into the task.
+    std::unique_ptr<T>                      pObj(std::make_unique<T>(std::move(obj)));
+    T const &                               ref(*pObj);
+
+    return Details::SerializeAsyncImpl<ArchiveT>(s, ref, chunkSize, std::move(pObj));
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
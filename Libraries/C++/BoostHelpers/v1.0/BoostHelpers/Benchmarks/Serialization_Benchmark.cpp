@@ -0,0 +1,482 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          Serialization_Benchmark.cpp
+///  \brief         Benchmarks for Serialization.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 22:15:40
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#include "../Serialization.h"
+#include "../SharedObject.h"
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "../UnitTests/SerializationTestObjs.h"
+#include "../UnitTests/SharedObjectTestObjs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------------
+// |
+// |  Allocation Tracking
+// |
+// ----------------------------------------------------------------------
+namespace {
+
+// Allocations are counted per thread so that the counter itself doesn't introduce
+// contention when benchmarks are run concurrently.
+thread_local size_t                         t_numAllocations(0);
+
+} // anonymous namespace
+
+void * operator new(std::size_t size) {
+    ++t_numAllocations;
+
+    if(void *pMemory = std::malloc(size ? size : 1))
+        return pMemory;
+
+    throw std::bad_alloc();
+}
+
+// The replacement operators allocate with malloc, so freeing memory allocated by
+// (the replacement) operator new is correct.
+#if (defined __GNUC__ && !defined __clang__ && __GNUC__ >= 11)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void *pMemory) noexcept {
+    std::free(pMemory);
+}
+
+void operator delete(void *pMemory, std::size_t) noexcept {
+    std::free(pMemory);
+}
+
+#if (defined __GNUC__ && !defined __clang__ && __GNUC__ >= 11)
+#   pragma GCC diagnostic pop
+#endif
+
+// ----------------------------------------------------------------------
+// |
+// |  Benchmark Infrastructure
+// |
+// ----------------------------------------------------------------------
+namespace {
+
+volatile size_t                             g_sink(0);
+
+// Used by benchmarks that run concurrently
+thread_local volatile size_t                t_sink(0);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         Runner
+///  \brief         Runs each benchmark for at least the minimum duration
+///                 and collects the results.
+///
+class Runner {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    Runner(double min_seconds, std::string filter) :
+        _minSeconds(min_seconds),
+        _filter(std::move(filter))
+    {}
+
+    template <typename FuncT>
+    void Run(char const *fixture, char const *archive, char const *operation, size_t bytes_per_op, FuncT const &func) {
+        RunImpl(std::string(fixture) + "/" + archive + "/" + operation, 1, bytes_per_op, func);
+    }
+
+    /// Invokes the functor on each of the threads at the same time (each thread using
+    /// its own archive); the results are for all of the threads combined.
+    template <typename FuncT>
+    void RunConcurrent(char const *fixture, char const *archive, char const *operation, size_t num_threads, size_t bytes_per_op, FuncT const &func) {
+        RunImpl(std::string(fixture) + "/" + archive + "/" + operation + "/threads:" + std::to_string(num_threads), num_threads, bytes_per_op, func);
+    }
+
+    /// Writes the results as JSON.
+    void Write(std::ostream &out) const {
+        out << "[\n";
+
+        for(size_t index = 0; index < _results.size(); ++index) {
+            Result const &                  result(_results[index]);
+
+            out << "  {"
+                << "\"name\": \"" << result.name << "\", "
+                << "\"threads\": " << result.threads << ", "
+                << "\"iterations\": " << result.iterations << ", "
+                << "\"ops_per_sec\": " << result.opsPerSec << ", "
+                << "\"bytes_per_sec\": " << result.bytesPerSec << ", "
+                << "\"allocs_per_op\": " << result.allocsPerOp << ", "
+                << "\"bytes_per_op\": " << result.bytesPerOp << ", "
+                << "\"type_registrations\": " << result.typeRegistrations
+                << "}" << (index + 1 == _results.size() ? "" : ",") << "\n";
+        }
+
+        out << "]\n";
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    using Clock                             = std::chrono::steady_clock;
+
+    struct Result {
+        std::string                         name;
+        size_t                              threads;
+        size_t                              iterations;
+        double                              opsPerSec;
+        double                              bytesPerSec;
+        double                              allocsPerOp;
+        size_t                              bytesPerOp;
+
+        /// Types registered with boost while measuring; this should always be 0,
+        /// as types are registered before main (see SERIALIZATION_POLYMORPHIC_DEFINE).
+        size_t                              typeRegistrations;
+    };
+
+    struct Measurement {
+        double                              seconds;
+        size_t                              allocations;
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    double const                            _minSeconds;
+    std::string const                       _filter;
+
+    std::vector<Result>                     _results;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    template <typename FuncT>
+    void RunImpl(std::string name, size_t num_threads, size_t bytes_per_op, FuncT const &func) {
+        if(_filter.empty() == false && name.find(_filter) == std::string::npos)
+            return;
+
+        // Warm up: the first invocation initializes the archive's serializers
+        func();
+
+        size_t                              iterations(1);
+
+        while(true) {
+            size_t const                    registrationsStart(BoostHelpers::Serialization::Details::GetNumTypeRegistrations().load());
+            Measurement const               measurement(num_threads == 1 ? Measure(iterations, func) : MeasureConcurrent(num_threads, iterations, func));
+            size_t const                    registrations(BoostHelpers::Serialization::Details::GetNumTypeRegistrations().load() - registrationsStart);
+
+            if(measurement.seconds >= _minSeconds || iterations >= (size_t(1) << 32)) {
+                size_t const                numOps(iterations * num_threads);
+                double const                opsPerSec(static_cast<double>(numOps) / measurement.seconds);
+
+                _results.emplace_back(
+                    Result{
+                        std::move(name),
+                        num_threads,
+                        iterations,
+                        opsPerSec,
+                        opsPerSec * static_cast<double>(bytes_per_op),
+                        static_cast<double>(measurement.allocations) / static_cast<double>(numOps),
+                        bytes_per_op,
+                        registrations
+                    }
+                );
+
+                std::cerr << _results.back().name << ": " << _results.back().opsPerSec << " ops/sec\n";
+                return;
+            }
+
+            iterations *= 2;
+        }
+    }
+
+    template <typename FuncT>
+    static Measurement Measure(size_t iterations, FuncT const &func) {
+        size_t const                        allocationsStart(t_numAllocations);
+        Clock::time_point const             start(Clock::now());
+
+        for(size_t iteration = 0; iteration < iterations; ++iteration)
+            func();
+
+        return Measurement{ std::chrono::duration<double>(Clock::now() - start).count(), t_numAllocations - allocationsStart };
+    }
+
+    template <typename FuncT>
+    static Measurement MeasureConcurrent(size_t num_threads, size_t iterations, FuncT const &func) {
+        std::atomic<size_t>                 numReady(0);
+        std::atomic<bool>                   isStarted(false);
+        std::atomic<size_t>                 allocations(0);
+        std::vector<std::thread>            threads;
+
+        for(size_t index = 0; index < num_threads; ++index) {
+            threads.emplace_back(
+                [&](void) {
+                    // Each thread warms up (creating its thread_local state) before the measurement begins
+                    func();
+
+                    ++numReady;
+                    while(isStarted.load() == false)
+                        std::this_thread::yield();
+
+                    size_t const            allocationsStart(t_numAllocations);
+
+                    for(size_t iteration = 0; iteration < iterations; ++iteration)
+                        func();
+
+                    allocations += t_numAllocations - allocationsStart;
+                }
+            );
+        }
+
+        while(numReady.load() != num_threads)
+            std::this_thread::yield();
+
+        Clock::time_point const             start(Clock::now());
+
+        isStarted = true;
+
+        for(auto &thread : threads)
+            thread.join();
+
+        return Measurement{ std::chrono::duration<double>(Clock::now() - start).count(), allocations.load() };
+    }
+};
+
+template <typename OArchiveT, typename IArchiveT, typename T>
+void BenchmarkObject(Runner &runner, char const *fixture, char const *archive, T const &obj) {
+    std::ostringstream                      out;
+
+    obj.template Serialize<OArchiveT>(out);
+
+    std::string const                       data(out.str());
+
+    runner.Run(
+        fixture, archive, "Serialize", data.size(),
+        [&obj, &out](void) {
+            out.seekp(0);
+            obj.template Serialize<OArchiveT>(out);
+        }
+    );
+
+    runner.Run(
+        fixture, archive, "Deserialize", data.size(),
+        [&data](void) {
+            BoostHelpers::Serialization::Details::FixedBufferStreambuf      buffer(data.data(), data.size());
+            std::istream                                                    in(&buffer);
+            T const                                                         other(T::template Deserialize<IArchiveT>(in));
+
+            g_sink = g_sink + reinterpret_cast<size_t>(&other);
+        }
+    );
+
+    runner.Run(
+        fixture, archive, "GetSerializedSize", data.size(),
+        [&obj](void) {
+            g_sink = g_sink + obj.template GetSerializedSize<OArchiveT>();
+        }
+    );
+}
+
+template <typename OArchiveT, typename IArchiveT, typename DeserializeT, typename PtrT>
+void BenchmarkPtr(Runner &runner, char const *fixture, char const *archive, PtrT const &pObj) {
+    std::ostringstream                      out;
+
+    pObj->template SerializePtr<OArchiveT>(out);
+
+    std::string const                       data(out.str());
+
+    runner.Run(
+        fixture, archive, "SerializePtr", data.size(),
+        [&pObj, &out](void) {
+            out.seekp(0);
+            pObj->template SerializePtr<OArchiveT>(out);
+        }
+    );
+
+    runner.Run(
+        fixture, archive, "DeserializePtr", data.size(),
+        [&data](void) {
+            BoostHelpers::Serialization::Details::FixedBufferStreambuf      buffer(data.data(), data.size());
+            std::istream                                                    in(&buffer);
+            auto const                                                      pOther(DeserializeT::template DeserializePtr<IArchiveT>(in));
+
+            g_sink = g_sink + reinterpret_cast<size_t>(pOther.get());
+        }
+    );
+}
+
+/// Serializes and deserializes objects concurrently with an increasing number of threads
+/// to measure how throughput scales; every thread uses its own streams and archives.
+template <typename OArchiveT, typename IArchiveT, typename DeserializeT, typename PtrT>
+void BenchmarkConcurrent(Runner &runner, char const *fixture, char const *archive, size_t max_threads, PtrT const &pObj) {
+    std::ostringstream                      out;
+
+    pObj->template SerializePtr<OArchiveT>(out);
+
+    std::string const                       data(out.str());
+    std::vector<size_t>                     threadCounts;
+
+    for(size_t numThreads = 1; numThreads < max_threads; numThreads *= 2)
+        threadCounts.emplace_back(numThreads);
+
+    threadCounts.emplace_back(max_threads);
+
+    for(size_t numThreads : threadCounts) {
+        runner.RunConcurrent(
+            fixture, archive, "SerializePtr", numThreads, data.size(),
+            [&pObj](void) {
+                thread_local std::ostringstream                             threadOut;
+
+                threadOut.seekp(0);
+                pObj->template SerializePtr<OArchiveT>(threadOut);
+            }
+        );
+
+        runner.RunConcurrent(
+            fixture, archive, "DeserializePtr", numThreads, data.size(),
+            [&data](void) {
+                BoostHelpers::Serialization::Details::FixedBufferStreambuf      buffer(data.data(), data.size());
+                std::istream                                                    in(&buffer);
+                auto const                                                      pOther(DeserializeT::template DeserializePtr<IArchiveT>(in));
+
+                t_sink = t_sink + reinterpret_cast<size_t>(pOther.get());
+            }
+        );
+    }
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void BenchmarkArchive(Runner &runner, char const *archive, size_t max_threads) {
+    BenchmarkObject<OArchiveT, IArchiveT>(runner, "Flat", archive, FlatObj(10, 20.0, true, "thirty"));
+    BenchmarkObject<OArchiveT, IArchiveT>(runner, "MultiBase", archive, MultiMemberMultiBaseObj(10, true, 'c', 1.0, 2.0f, std::make_unique<MultiMemberObj>(true, 'q')));
+
+    {
+        std::vector<FlatObj>                items;
+
+        for(int index = 0; index < 1000; ++index)
+            items.emplace_back(index, index * 2.0, index % 2 == 0, std::to_string(index));
+
+        BenchmarkObject<OArchiveT, IArchiveT>(runner, "Vector1000", archive, VectorObj(std::move(items)));
+    }
+
+    BenchmarkPtr<OArchiveT, IArchiveT, BaseObj>(runner, "Polymorphic", archive, std::make_unique<Derived1Obj>(10, true, 'c'));
+
+    {
+        // Each node is referenced twice
+        std::vector<std::shared_ptr<Base>>                                  nodes;
+
+        for(int index = 0; index < 100; ++index)
+            nodes.emplace_back(Base::Create(index));
+
+        for(int index = 0; index < 100; ++index)
+            nodes.emplace_back(nodes[static_cast<size_t>(index)]);
+
+        BenchmarkPtr<OArchiveT, IArchiveT, Graph>(runner, "SharedObjectGraph", archive, Graph::Create(std::move(nodes)));
+    }
+
+    BenchmarkConcurrent<OArchiveT, IArchiveT, BaseObj>(runner, "Polymorphic", archive, max_threads, std::make_unique<Derived1Obj>(10, true, 'c'));
+}
+
+/// Measures the SerializationPOD on its own: the construction of the view used to
+/// save an object and saving the object to an archive that has already been created.
+void BenchmarkSerializationPOD(Runner &runner) {
+    using SerializationPOD                  = MultiMemberMultiBaseObj::SerializationPOD;
+
+    std::cerr << "sizeof(SerializationPOD::SerializeData): " << sizeof(SerializationPOD::SerializeData) << "\n"
+              << "sizeof(SerializationPOD::DeserializeData): " << sizeof(SerializationPOD::DeserializeData) << "\n";
+
+    MultiMemberMultiBaseObj const           obj(1, true, 'c', 2.0, 3.0f, std::make_unique<MultiMemberObj>(false, 'd'));
+
+    runner.Run(
+        "MultiBase", "none", "SerializeData", 0,
+        [&obj](void) {
+            SerializationPOD::SerializeData const                           data(obj);
+
+            g_sink = g_sink + reinterpret_cast<size_t>(&data);
+        }
+    );
+
+    std::ostringstream                      out;
+    boost::archive::binary_oarchive         ar(out, boost::archive::no_header | boost::archive::no_codecvt);
+
+    obj.Serialize(ar);
+
+    size_t const                            bytesPerOp(static_cast<size_t>(out.tellp()));
+
+    runner.Run(
+        "MultiBase", "binary", "SerializeToArchive", bytesPerOp,
+        [&obj, &out, &ar](void) {
+            out.seekp(0);
+            obj.Serialize(ar);
+        }
+    );
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------
+// |
+// |  Main
+// |
+// ----------------------------------------------------------------------
+int main(int argc, char const * const *argv) {
+    double                                  minSeconds(0.5);
+    std::string                             filter;
+    size_t                                  maxThreads(std::max(std::thread::hardware_concurrency(), 1u));
+
+    for(int index = 1; index < argc; ++index) {
+        std::string const                   arg(argv[index]);
+
+        if(arg == "--min-time" && index + 1 < argc)
+            minSeconds = std::atof(argv[++index]);
+        else if(arg == "--filter" && index + 1 < argc)
+            filter = argv[++index];
+        else if(arg == "--max-threads" && index + 1 < argc)
+            maxThreads = std::max<size_t>(static_cast<size_t>(std::atol(argv[++index])), 1);
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--min-time <seconds>] [--filter <substring>] [--max-threads <num>]\n\n"
+                      << "Results are written to stdout as JSON; progress is written to stderr.\n";
+            return arg == "--help" ? 0 : -1;
+        }
+    }
+
+    Runner                                  runner(minSeconds, std::move(filter));
+
+    BenchmarkArchive<boost::archive::text_oarchive, boost::archive::text_iarchive>(runner, "text", maxThreads);
+    BenchmarkArchive<boost::archive::xml_oarchive, boost::archive::xml_iarchive>(runner, "xml", maxThreads);
+    BenchmarkArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(runner, "binary", maxThreads);
+    BenchmarkSerializationPOD(runner);
+
+    runner.Write(std::cout);
+    return 0;
+}
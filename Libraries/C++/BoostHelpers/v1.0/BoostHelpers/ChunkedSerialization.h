@@ -0,0 +1,233 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ChunkedSerialization.h
+///  \brief         Contains the SerializeChunked and DeserializeChunked functions
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 20:07:52
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/SerializeRange.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+/// Number of elements written to each block by SerializeChunked by default.
+constexpr size_t const DefaultChunkedElementsPerBlock = 64 * 1024;
+
+namespace Details {
+
+inline size_t GetChunkedMaxConcurrency(size_t max_concurrency) {
+    if(max_concurrency == 0)
+        max_concurrency = std::thread::hardware_concurrency();
+
+    return max_concurrency ? max_concurrency : 1;
+}
+
+inline void WriteChunkedValue(std::ostream &s, std::uint64_t value) {
+    s.write(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+inline std::uint64_t ReadChunkedValue(std::istream &s) {
+    std::uint64_t                           value;
+
+    if(!s.read(reinterpret_cast<char *>(&value), sizeof(value)))
+        throw std::runtime_error("Invalid chunked data");
+
+    return value;
+}
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SerializeChunked
+///  \brief         Serializes a range of objects generated by SERIALIZATION as
+///                 a sequence of independent blocks that are encoded in parallel.
+///
+///                 Each block contains up to `elements_per_block` elements and
+///                 is written by SerializeRange using its own archive, so
+///                 blocks can be encoded and decoded independently of each
+///                 other; any archive (binary, text, etc.) can be used. Note
+///                 that objects are only tracked within a block - an object
+///                 referenced by shared pointers in different blocks is
+///                 deserialized once per block.
+///
+///                 Format (integer values are 64-bit, in native byte order;
+///                 the stream must be opened in binary mode):
+///
+///                     <Number of blocks>
+///                     For each block:
+///                         <Number of elements in the block>
+///                         <Size of the block in bytes>
+///                         <Block data>
+///
+///                 The sizes act as an index of the blocks; readers can skip
+///                 blocks and start decoding a block before the blocks that
+///                 precede it have been decoded.
+///
+///                 Blocks are written in order as they are completed; at most
+///                 `max_concurrency` blocks are encoded (and held in memory)
+///                 at any time. A value of 0 uses std::thread::hardware_concurrency.
+///
+template <typename ArchiveT, typename RandomAccessIteratorT>
+std::ostream & SerializeChunked(
+    std::ostream &s,
+    RandomAccessIteratorT first,
+    RandomAccessIteratorT last,
+    size_t elements_per_block=DefaultChunkedElementsPerBlock,
+    size_t max_concurrency=0
+) {
+    if(elements_per_block == 0)
+        throw std::invalid_argument("elements_per_block");
+
+    max_concurrency = Details::GetChunkedMaxConcurrency(max_concurrency);
+
+    size_t const                            numElements(static_cast<size_t>(std::distance(first, last)));
+    size_t const                            numBlocks((numElements + elements_per_block - 1) / elements_per_block);
+
+    Details::WriteChunkedValue(s, numBlocks);
+
+    // ----------------------------------------------------------------------
+    struct Block {
+        size_t                              numElements;
+        std::future<std::string>            data;
+    };
+
+    using Blocks                            = std::deque<Block>;
+    // ----------------------------------------------------------------------
+
+    Blocks                                  blocks;
+    size_t                                  blockIndex(0);
+
+    while(blockIndex < numBlocks || blocks.empty() == false) {
+        while(blockIndex < numBlocks && blocks.size() < max_concurrency) {
+            RandomAccessIteratorT const     blockFirst(first + static_cast<std::ptrdiff_t>(blockIndex * elements_per_block));
+            size_t const                    blockElements(std::min(elements_per_block, numElements - blockIndex * elements_per_block));
+            RandomAccessIteratorT const     blockLast(blockFirst + static_cast<std::ptrdiff_t>(blockElements));
+
+            blocks.push_back(
+                Block{
+                    blockElements,
+                    std::async(
+                        std::launch::async,
+                        [blockFirst, blockLast](void) {
+                            std::ostringstream                          out;
+
+                            {
+                                ArchiveT                                ar(out);
+
+                                SerializeRange(ar, blockFirst, blockLast);
+                            }
+
+                            return out.str();
+                        }
+                    )
+                }
+            );
+
+            ++blockIndex;
+        }
+
+        Block &                             block(blocks.front());
+        std::string const                   data(block.data.get());
+
+        Details::WriteChunkedValue(s, block.numElements);
+        Details::WriteChunkedValue(s, data.size());
+        s.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+        blocks.pop_front();
+    }
+
+    return s;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeserializeChunked
+///  \brief         Deserializes objects written by SerializeChunked, decoding
+///                 at most `max_concurrency` blocks in parallel (a value of 0
+///                 uses std::thread::hardware_concurrency).
+///
+template <typename ArchiveT, typename T>
+std::vector<T> DeserializeChunked(std::istream &s, size_t max_concurrency=0) {
+    max_concurrency = Details::GetChunkedMaxConcurrency(max_concurrency);
+
+    size_t const                            numBlocks(Details::ReadChunkedValue(s));
+
+    using Blocks                            = std::deque<std::future<std::vector<T>>>;
+
+    std::vector<T>                          result;
+    Blocks                                  blocks;
+    size_t                                  blockIndex(0);
+
+    while(blockIndex < numBlocks || blocks.empty() == false) {
+        while(blockIndex < numBlocks && blocks.size() < max_concurrency) {
+            size_t const                    blockElements(Details::ReadChunkedValue(s));
+            std::string                     data(Details::ReadChunkedValue(s), '\0');
+
+            if(!s.read(data.data(), static_cast<std::streamsize>(data.size())))
+                throw std::runtime_error("Invalid chunked data");
+
+            blocks.push_back(
+                std::async(
+                    std::launch::async,
+                    [data = std::move(data), blockElements](void) {
+                        Details::FixedBufferStreambuf                   buffer(data.data(), data.size());
+                        std::istream                                    in(&buffer);
+                        ArchiveT                                        ar(in);
+                        std::vector<T>                                  items;
+
+                        DeserializeRange<ArchiveT, T>(ar, items);
+
+                        if(items.size() != blockElements)
+                            throw std::runtime_error("Invalid chunked data");
+
+                        return items;
+                    }
+                )
+            );
+
+            ++blockIndex;
+        }
+
+        std::vector<T>                      items(blocks.front().get());
+
+        if(result.empty())
+            result = std::move(items);
+        else
+            std::move(items.begin(), items.end(), std::back_inserter(result));
+
+        blocks.pop_front();
+    }
+
+    return result;
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
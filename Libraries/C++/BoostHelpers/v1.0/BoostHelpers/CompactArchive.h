@@ -0,0 +1,347 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompactArchive.h
+///  \brief         Contains the compact_oarchive and compact_iarchive objects
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 22:18:36
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/Serialization.h>
+
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/basic_archive.hpp>
+#include <boost/archive/detail/common_iarchive.hpp>
+#include <boost/archive/detail/common_oarchive.hpp>
+#include <boost/archive/detail/register_archive.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/item_version_type.hpp>
+#include <boost/serialization/library_version_type.hpp>
+
+// Archives that aren't compiled into the boost serialization library must
+// instantiate their serializer maps.
+#include <boost/archive/impl/archive_serializer_map.ipp>
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+namespace Details {
+
+// Values that boost uses to write archive information (versions, ids, and sizes) and the
+// fundamental types that they wrap; these functions are never defined.
+std::uint_least16_t GetArchiveValueType(boost::serialization::library_version_type const &);
+std::uint_least32_t GetArchiveValueType(boost::archive::version_type const &);
+std::int_least16_t GetArchiveValueType(boost::archive::class_id_type const &);
+std::uint_least32_t GetArchiveValueType(boost::archive::object_id_type const &);
+bool GetArchiveValueType(boost::archive::tracking_type const &);
+unsigned int GetArchiveValueType(boost::serialization::item_version_type const &);
+std::size_t GetArchiveValueType(boost::serialization::collection_size_type const &);
+
+template <typename T, typename EnableIfT=void>
+struct ArchiveValueTypeImpl {};
+
+template <typename T>
+struct ArchiveValueTypeImpl<T, std::void_t<decltype(GetArchiveValueType(std::declval<T const &>()))>> {
+    using type                              = decltype(GetArchiveValueType(std::declval<T const &>()));
+};
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsArchiveValue         = false;
+
+template <typename T>
+constexpr bool const IsArchiveValue<T, std::void_t<typename ArchiveValueTypeImpl<T>::type>> = true;
+
+template <typename T>
+constexpr bool const IsCompactVarint        = std::is_integral_v<T> && std::is_same_v<T, bool> == false && sizeof(T) > 1;
+
+template <typename T>
+constexpr bool const IsCompactRaw           = std::is_floating_point_v<T> || std::is_same_v<T, bool> || (std::is_integral_v<T> && sizeof(T) == 1);
+
+template <typename T>
+constexpr std::make_unsigned_t<T> ZigZagEncode(T value) {
+    using UnsignedT                         = std::make_unsigned_t<T>;
+
+    if constexpr(std::is_signed_v<T>)
+        return static_cast<UnsignedT>((static_cast<UnsignedT>(value) << 1) ^ static_cast<UnsignedT>(value < 0 ? ~UnsignedT(0) : UnsignedT(0)));
+    else
+        return value;
+}
+
+template <typename T>
+constexpr T ZigZagDecode(std::make_unsigned_t<T> value) {
+    if constexpr(std::is_signed_v<T>)
+        return static_cast<T>((value >> 1) ^ (~(value & 1) + 1));
+    else
+        return value;
+}
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         compact_oarchive
+///  \brief         Binary archive optimized for size: integers (including sizes,
+///                 versions, and ids written by boost) are written as LEB128
+///                 varints (signed values are zig-zag encoded first), names
+///                 provided by name-value pairs are not written, and the header
+///                 only contains the boost library version.
+///
+///                 Types generated by SERIALIZATION don't write class information,
+///                 so non-polymorphic objects are written as the varint-encoded
+///                 values of their members. Floating point values are written as
+///                 raw bytes, and the archive doesn't account for differences in
+///                 byte order between platforms.
+///
+///                 Example:
+///                     obj.Serialize<BoostHelpers::Serialization::compact_oarchive>(out);
+///
+///                     MyObj const                                         new_obj(MyObj::Deserialize<BoostHelpers::Serialization::compact_iarchive>(in));
+///
+class compact_oarchive : public boost::archive::detail::common_oarchive<compact_oarchive> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    compact_oarchive(std::ostream &os, unsigned int flags=0) :
+        compact_oarchive(*os.rdbuf(), flags)
+    {}
+
+    compact_oarchive(std::streambuf &sb, unsigned int flags=0) :
+        boost::archive::detail::common_oarchive<compact_oarchive>(flags),
+        _sb(sb) {
+        if((flags & boost::archive::no_header) == 0)
+            *this << boost::archive::BOOST_ARCHIVE_VERSION();
+    }
+
+    void save_binary(void const *address, std::size_t count) {
+        if(static_cast<std::size_t>(_sb.sputn(static_cast<char const *>(address), static_cast<std::streamsize>(count))) != count)
+            boost::serialization::throw_exception(boost::archive::archive_exception(boost::archive::archive_exception::output_stream_error));
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    using CommonArchive                     = boost::archive::detail::common_oarchive<compact_oarchive>;
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::streambuf &                        _sb;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    friend class boost::archive::detail::interface_oarchive<compact_oarchive>;
+    friend class boost::archive::save_access;
+
+    template <typename T>
+    void save_override(T const &t) {
+        CommonArchive::save_override(t);
+    }
+
+    void save_override(boost::archive::class_id_optional_type const &) {}
+
+    void save_override(boost::archive::class_name_type const &t) {
+        save(std::string(t));
+    }
+
+    template <typename T>
+    void save(T const &t) {
+        if constexpr(Details::IsCompactRaw<T>)
+            save_binary(&t, sizeof(T));
+        else if constexpr(Details::IsCompactVarint<T>)
+            SaveVarint(Details::ZigZagEncode(t));
+        else if constexpr(Details::IsArchiveValue<T>)
+            save(static_cast<typename Details::ArchiveValueTypeImpl<T>::type>(t));
+        else
+            static_assert(Details::IsCompactRaw<T>, "This primitive type is not supported by compact_oarchive");
+    }
+
+    void save(std::string const &s) {
+        save(s.size());
+        save_binary(s.data(), s.size());
+    }
+
+    void save(std::wstring const &s) {
+        save(s.size());
+
+        // Characters are code points, so they aren't zig-zag encoded
+        for(wchar_t c : s)
+            SaveVarint(static_cast<std::make_unsigned_t<wchar_t>>(c));
+    }
+
+    template <typename T>
+    void SaveVarint(T value) {
+        static_assert(std::is_unsigned_v<T>, "Values must be zig-zag encoded before they are written");
+
+        unsigned char                       buffer[(sizeof(T) * 8 + 6) / 7];
+        size_t                              size(0);
+
+        while(value >= 0x80) {
+            buffer[size++] = static_cast<unsigned char>(value | 0x80);
+            value >>= 7;
+        }
+
+        buffer[size++] = static_cast<unsigned char>(value);
+        save_binary(buffer, size);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         compact_iarchive
+///  \brief         Reads content written by compact_oarchive.
+///
+class compact_iarchive : public boost::archive::detail::common_iarchive<compact_iarchive> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    compact_iarchive(std::istream &is, unsigned int flags=0) :
+        compact_iarchive(*is.rdbuf(), flags)
+    {}
+
+    compact_iarchive(std::streambuf &sb, unsigned int flags=0) :
+        boost::archive::detail::common_iarchive<compact_iarchive>(flags),
+        _sb(sb) {
+        if((flags & boost::archive::no_header) == 0) {
+            boost::serialization::library_version_type  version;
+
+            *this >> version;
+
+            if(boost::archive::BOOST_ARCHIVE_VERSION() < version)
+                boost::serialization::throw_exception(boost::archive::archive_exception(boost::archive::archive_exception::unsupported_version));
+
+            set_library_version(version);
+        }
+    }
+
+    void load_binary(void *address, std::size_t count) {
+        if(static_cast<std::size_t>(_sb.sgetn(static_cast<char *>(address), static_cast<std::streamsize>(count))) != count)
+            boost::serialization::throw_exception(boost::archive::archive_exception(boost::archive::archive_exception::input_stream_error));
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    using CommonArchive                     = boost::archive::detail::common_iarchive<compact_iarchive>;
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::streambuf &                        _sb;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    friend class boost::archive::detail::interface_iarchive<compact_iarchive>;
+    friend class boost::archive::load_access;
+
+    template <typename T>
+    void load_override(T &t) {
+        CommonArchive::load_override(t);
+    }
+
+    void load_override(boost::archive::class_id_optional_type &) {}
+
+    void load_override(boost::archive::class_name_type &t) {
+        std::string                         name;
+
+        load(name);
+
+        if(name.size() > BOOST_SERIALIZATION_MAX_KEY_SIZE - 1)
+            boost::serialization::throw_exception(boost::archive::archive_exception(boost::archive::archive_exception::invalid_class_name));
+
+        std::memcpy(static_cast<char *>(t), name.data(), name.size());
+        static_cast<char *>(t)[name.size()] = 0;
+    }
+
+    template <typename T>
+    void load(T &t) {
+        if constexpr(Details::IsCompactRaw<T>)
+            load_binary(&t, sizeof(T));
+        else if constexpr(Details::IsCompactVarint<T>)
+            t = Details::ZigZagDecode<T>(LoadVarint<std::make_unsigned_t<T>>());
+        else if constexpr(Details::IsArchiveValue<T>)
+            load(static_cast<typename Details::ArchiveValueTypeImpl<T>::type &>(t));
+        else
+            static_assert(Details::IsCompactRaw<T>, "This primitive type is not supported by compact_iarchive");
+    }
+
+    void load(std::string &s) {
+        std::string::size_type              size;
+
+        load(size);
+
+        s.resize(size);
+        load_binary(s.data(), size);
+    }
+
+    void load(std::wstring &s) {
+        std::wstring::size_type             size;
+
+        load(size);
+
+        s.resize(size);
+
+        for(wchar_t &c : s)
+            c = static_cast<wchar_t>(LoadVarint<std::make_unsigned_t<wchar_t>>());
+    }
+
+    template <typename T>
+    T LoadVarint(void) {
+        T                                   result(0);
+        unsigned int                        shift(0);
+
+        while(true) {
+            std::streambuf::int_type const  c(_sb.sbumpc());
+
+            if(std::streambuf::traits_type::eq_int_type(c, std::streambuf::traits_type::eof()))
+                boost::serialization::throw_exception(boost::archive::archive_exception(boost::archive::archive_exception::input_stream_error));
+
+            unsigned char const             byte(static_cast<unsigned char>(c));
+
+            if(shift >= sizeof(T) * 8 || (shift && (static_cast<T>(byte & 0x7F) >> (sizeof(T) * 8 - shift))))
+                boost::serialization::throw_exception(boost::archive::archive_exception(boost::archive::archive_exception::input_stream_error));
+
+            result |= static_cast<T>(static_cast<T>(byte & 0x7F) << shift);
+
+            if((byte & 0x80) == 0)
+                return result;
+
+            shift += 7;
+        }
+    }
+};
+
+namespace Details {
+
+// Names provided by name-value pairs aren't written, so the generated code
+// writes values without the nvp wrapper.
+template <>
+constexpr bool const IgnoresSerializationNames<compact_oarchive> = true;
+
+template <>
+constexpr bool const IgnoresSerializationNames<compact_iarchive> = true;
+
+} // namespace Details
+
+} // namespace Serialization
+} // namespace BoostHelpers
+
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(BoostHelpers::Serialization::compact_oarchive)
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(BoostHelpers::Serialization::compact_iarchive)
@@ -0,0 +1,165 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompressedSerialization.h
+///  \brief         Contains the SerializeCompressed and DeserializeCompressed
+///                 functions
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 23:02:47
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/Serialization.h>
+
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+/// Size of the buffers used by the compression filters when a block size isn't provided
+constexpr std::streamsize const DefaultCompressionBlockSize = 64 * 1024;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         CompressionCodec
+///  \brief         Compression filters (and their buffers) used by
+///                 SerializeCompressed and DeserializeCompressed. The filters
+///                 are created the first time that they are used and reset
+///                 when each call completes, so a codec that is used for many
+///                 calls only allocates its buffers once.
+///
+///                 A codec may only be used by one call at a time.
+///
+template <typename CompressorT, typename DecompressorT, typename ParamsT>
+class CompressionCodec {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using Compressor                        = CompressorT;
+    using Decompressor                      = DecompressorT;
+    using Params                            = ParamsT;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    CompressionCodec(ParamsT params=ParamsT(), std::streamsize blockSize=DefaultCompressionBlockSize) :
+        _params(std::move(params)),
+        _blockSize(blockSize) {
+        if(_blockSize <= 0)
+            throw std::invalid_argument("blockSize");
+    }
+
+    CompressionCodec(CompressionCodec const &) = delete;
+    CompressionCodec & operator =(CompressionCodec const &) = delete;
+
+    std::streamsize GetBlockSize(void) const { return _blockSize; }
+
+    /// Filters share their state and buffers with copies of themselves, so the
+    /// values returned here can be pushed onto many filtering streams.
+    CompressorT & GetCompressor(void) {
+        if(!_compressor)
+            _compressor.emplace(_params, _blockSize);
+
+        return *_compressor;
+    }
+
+    DecompressorT & GetDecompressor(void) {
+        if(!_decompressor)
+            _decompressor.emplace(_params, _blockSize);
+
+        return *_decompressor;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    ParamsT const                           _params;
+    std::streamsize const                   _blockSize;
+
+    std::optional<CompressorT>              _compressor;
+    std::optional<DecompressorT>            _decompressor;
+};
+
+using ZstdCodec                             = CompressionCodec<boost::iostreams::zstd_compressor, boost::iostreams::zstd_decompressor, boost::iostreams::zstd_params>;
+using ZlibCodec                             = CompressionCodec<boost::iostreams::zlib_compressor, boost::iostreams::zlib_decompressor, boost::iostreams::zlib_params>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SerializeCompressed
+///  \brief         Serializes an object generated by SERIALIZATION, compressing
+///                 the archive's output as it is written to the stream (rather
+///                 than serializing the object to memory and compressing the
+///                 result in a separate pass).
+///
+///                 Example:
+///                     ZstdCodec                                           codec;
+///
+///                     SerializeCompressed<boost::archive::binary_oarchive>(out, obj, codec);
+///
+///                     // ...
+///
+///                     MyObj const                                         new_obj(DeserializeCompressed<boost::archive::binary_iarchive, MyObj>(in, codec));
+///
+template <typename ArchiveT, typename T, typename CodecT>
+std::ostream & SerializeCompressed(std::ostream &s, T const &obj, CodecT &codec) {
+    static_assert(Details::has_SerializationPOD<T>, "SerializeCompressed is only available for types generated by SERIALIZATION");
+
+    boost::iostreams::filtering_ostream     stream;
+
+    stream.push(codec.GetCompressor(), codec.GetBlockSize());
+    stream.push(s, codec.GetBlockSize());
+
+    {
+        ArchiveT                            ar(stream);
+
+        obj.Serialize(ar);
+    }
+
+    // Flush the compressor and reset it so that it can be used again
+    stream.reset();
+    return s;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeserializeCompressed
+///  \brief         Deserializes an object written by SerializeCompressed.
+///
+///                 Note that the decompressor reads the stream in blocks, so
+///                 the stream may be positioned beyond the end of the
+///                 compressed data when this function returns.
+///
+template <typename ArchiveT, typename T, typename CodecT>
+T DeserializeCompressed(std::istream &s, CodecT &codec) {
+    static_assert(Details::has_SerializationPOD<T>, "DeserializeCompressed is only available for types generated by SERIALIZATION");
+
+    boost::iostreams::filtering_istream     stream;
+
+    stream.push(codec.GetDecompressor(), codec.GetBlockSize());
+    stream.push(s, codec.GetBlockSize());
+
+    // The decompressor is reset (so that it can be used again) when the
+    // stream is destroyed.
+    ArchiveT                                ar(stream);
+
+    return T::Deserialize(ar);
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
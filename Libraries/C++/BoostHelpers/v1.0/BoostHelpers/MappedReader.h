@@ -0,0 +1,267 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          MappedReader.h
+///  \brief         Contains the MappedReader object
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 21:04:26
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/ChunkedSerialization.h>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          MappedFileFormat
+///  \brief         The format of the data read by MappedReader.
+///
+enum class MappedFileFormat {
+    Chunked,                                ///< Written by SerializeChunked
+    Range                                   ///< Written by SerializeRange (to a new archive)
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MappedReader
+///  \brief         Provides random access to the elements of a file written by
+///                 SerializeChunked or SerializeRange without reading the
+///                 entire file. The file is memory-mapped and elements are
+///                 deserialized on demand.
+///
+///                 Example:
+///                     MappedReader<boost::archive::binary_iarchive, MyObj> const  reader("snapshot.dat");
+///
+///                     MyObj const                                         obj(reader.Get(12345));
+///
+///                 Creating the reader only reads the block headers of a chunked
+///                 file; an element is deserialized by reading the block that
+///                 contains it. When the archive is a binary archive and T doesn't
+///                 add state to the archive (see Details::IsArchiveStatelessMember),
+///                 the offset of each element within a block is recorded the first
+///                 time that the block is accessed, so that later accesses decode
+///                 only the requested element. Otherwise, the elements in the block
+///                 that precede the requested element are decoded (and discarded)
+///                 on every access.
+///
+///                 This object is not thread safe.
+///
+template <typename ArchiveT, typename T>
+class MappedReader {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using Archive                           = ArchiveT;
+    using Type                              = T;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MappedReader(std::string const &filename, MappedFileFormat format=MappedFileFormat::Chunked);
+
+    /// The memory must remain valid for the lifetime of the object.
+    MappedReader(void const *pData, size_t cData, MappedFileFormat format=MappedFileFormat::Chunked);
+
+    MappedReader(MappedReader const &) = delete;
+    MappedReader & operator =(MappedReader const &) = delete;
+
+    size_t GetSize(void) const;
+
+    T Get(size_t index) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    struct Block {
+        char const *                        pData;
+        size_t                              cData;
+        size_t                              firstIndex;
+        size_t                              numElements;
+
+        /// Offset of each element within the block; populated on first access
+        /// when UseOffsets is true.
+        mutable std::vector<size_t>         offsets;
+    };
+
+    using Blocks                            = std::vector<Block>;
+
+    static constexpr bool const UseOffsets  = Details::IsBitwiseArchive<ArchiveT> && Details::IsArchiveStatelessMember<T>();
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::optional<boost::iostreams::mapped_file_source> const               _file;
+    Blocks const                            _blocks;
+    size_t const                            _size;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    static Blocks CreateBlocks(char const *pData, size_t cData, MappedFileFormat format);
+    static Block CreateBlock(char const *pData, size_t cData, size_t firstIndex, std::optional<size_t> numElements);
+
+    static void SkipElement(ArchiveT &ar);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename ArchiveT, typename T>
+MappedReader<ArchiveT, T>::MappedReader(std::string const &filename, MappedFileFormat format) :
+    _file(std::in_place, filename),
+    _blocks(CreateBlocks(_file->data(), _file->size(), format)),
+    _size(_blocks.empty() ? 0 : _blocks.back().firstIndex + _blocks.back().numElements)
+{}
+
+template <typename ArchiveT, typename T>
+MappedReader<ArchiveT, T>::MappedReader(void const *pData, size_t cData, MappedFileFormat format) :
+    _blocks(CreateBlocks(static_cast<char const *>(pData), cData, format)),
+    _size(_blocks.empty() ? 0 : _blocks.back().firstIndex + _blocks.back().numElements)
+{}
+
+template <typename ArchiveT, typename T>
+size_t MappedReader<ArchiveT, T>::GetSize(void) const {
+    return _size;
+}
+
+template <typename ArchiveT, typename T>
+T MappedReader<ArchiveT, T>::Get(size_t index) const {
+    if(index >= _size)
+        throw std::out_of_range("index");
+
+    Block const &                           block(
+        *(
+            std::upper_bound(
+                _blocks.begin(),
+                _blocks.end(),
+                index,
+                [](size_t value, Block const &b) { return value < b.firstIndex; }
+            ) - 1
+        )
+    );
+
+    size_t const                            blockIndex(index - block.firstIndex);
+    Details::FixedBufferStreambuf           buffer(block.pData, block.cData);
+    std::istream                            in(&buffer);
+    ArchiveT                                ar(in);
+
+    if constexpr(UseOffsets) {
+        if(block.offsets.empty()) {
+            size_t                          count(Details::DeserializeRangeCount(ar));
+
+            block.offsets.reserve(count);
+
+            while(count--) {
+                block.offsets.push_back(static_cast<size_t>(buffer.pubseekoff(0, std::ios_base::cur, std::ios_base::in)));
+                SkipElement(ar);
+            }
+        }
+
+        buffer.pubseekpos(static_cast<std::streamoff>(block.offsets[blockIndex]), std::ios_base::in);
+    }
+    else {
+        Details::DeserializeRangeCount(ar);
+
+        for(size_t skipIndex = 0; skipIndex < blockIndex; ++skipIndex)
+            SkipElement(ar);
+    }
+
+    return T::Deserialize(ar, "item");
+}
+
+// ----------------------------------------------------------------------
+template <typename ArchiveT, typename T>
+typename MappedReader<ArchiveT, T>::Blocks MappedReader<ArchiveT, T>::CreateBlocks(char const *pData, size_t cData, MappedFileFormat format) {
+    Blocks                                  results;
+
+    if(format == MappedFileFormat::Range) {
+        results.emplace_back(CreateBlock(pData, cData, 0, std::nullopt));
+        return results;
+    }
+
+    char const *                            ptr(pData);
+    char const * const                      pEnd(pData + cData);
+
+    auto const                              readValueFunc(
+        [&ptr, &pEnd](void) {
+            std::uint64_t                   value;
+
+            if(static_cast<size_t>(pEnd - ptr) < sizeof(value))
+                throw std::runtime_error("Invalid chunked data");
+
+            std::memcpy(&value, ptr, sizeof(value));
+            ptr += sizeof(value);
+
+            return static_cast<size_t>(value);
+        }
+    );
+
+    size_t                                  numBlocks(readValueFunc());
+    size_t                                  firstIndex(0);
+
+    results.reserve(numBlocks);
+
+    while(numBlocks--) {
+        size_t const                        numElements(readValueFunc());
+        size_t const                        blockSize(readValueFunc());
+
+        if(static_cast<size_t>(pEnd - ptr) < blockSize)
+            throw std::runtime_error("Invalid chunked data");
+
+        results.emplace_back(CreateBlock(ptr, blockSize, firstIndex, numElements));
+
+        ptr += blockSize;
+        firstIndex += numElements;
+    }
+
+    return results;
+}
+
+template <typename ArchiveT, typename T>
+typename MappedReader<ArchiveT, T>::Block MappedReader<ArchiveT, T>::CreateBlock(char const *pData, size_t cData, size_t firstIndex, std::optional<size_t> numElements) {
+    if(numElements.has_value() == false) {
+        Details::FixedBufferStreambuf       buffer(pData, cData);
+        std::istream                        in(&buffer);
+        ArchiveT                            ar(in);
+
+        numElements = Details::DeserializeRangeCount(ar);
+    }
+
+    return Block{ pData, cData, firstIndex, *numElements, std::vector<size_t>() };
+}
+
+template <typename ArchiveT, typename T>
+void MappedReader<ArchiveT, T>::SkipElement(ArchiveT &ar) {
+    typename T::SerializationPOD::DeserializeData                           data;
+
+    Details::LoadNamed(ar, "item", data);
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
@@ -29,26 +29,72 @@
 #   pragma clang diagnostic ignored "-Wdeprecated-copy"
 #endif
 
-#include <boost/iostreams/device/null.hpp>
-#include <boost/iostreams/filter/counter.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/export.hpp>
+#include <boost/serialization/is_bitwise_serializable.hpp>
 #include <boost/serialization/level.hpp>
 #include <boost/serialization/split_member.hpp>
 #include <boost/serialization/tracking.hpp>
 #include <boost/serialization/traits.hpp>
+#include <boost/serialization/void_cast.hpp>
 
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/unique_ptr.hpp>
 
-#include <boost/variant.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/basic_binary_iarchive.hpp>
+#include <boost/archive/basic_binary_oarchive.hpp>
+#include <boost/archive/basic_text_iarchive.hpp>
+#include <boost/archive/basic_text_oarchive.hpp>
+
+#include <boost/archive/detail/archive_serializer_map.hpp>
+#include <boost/archive/detail/basic_iarchive.hpp>
+#include <boost/archive/detail/basic_oarchive.hpp>
+#include <boost/archive/detail/basic_pointer_iserializer.hpp>
+#include <boost/archive/detail/basic_pointer_oserializer.hpp>
 
 #if (defined __clang__ && __clang_major__ >= 10)
 #   pragma clang diagnostic pop
 #endif
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (defined __has_include)
+#   if __has_include(<memory_resource>)
+#       include <memory_resource>
+#   endif
+#   if __has_include(<span>)
+#       include <span>
+#   endif
+#endif
+
+// Define SERIALIZATION_STATS (consistently for all translation units) to record the
+// number of calls, latency, and bytes of the Serialize, Deserialize, SerializePtr, and
+// DeserializePtr methods generated by SERIALIZATION for each type; the statistics are
+// available via GetSerializationStats. Nothing is recorded by default, and the methods
+// are generated without any additional code.
+#if (defined SERIALIZATION_STATS)
+#   include <BoostHelpers/SerializationStats.h>
+#endif
+
 namespace BoostHelpers {
 namespace Serialization {
 
@@ -84,10 +130,26 @@ namespace Serialization {
 ///                     template <typename ArchiveT> ArchiveT & Serialize(ArchiveT &ar) const;
 ///                     template <typename Archive, typename CharT, typename TraitsT> std::basic_ostream<CharT, TraitsT> & Serialize(std::basic_ostream<CharT, TraitsT> &s) const;
 ///                     template <typename Archive, typename CharT, typename TraitsT> std::basic_streambuf<CharT, TraitsT> & Serialize(std::basic_streambuf<CharT, TraitsT> &s) const;
+///                     template <typename ArchiveT> static constexpr size_t SerializedSizeUpperBound;
 ///                     template <typename ArchiveT> size_t GetSerializedSize(void) const;
 ///                     template <typename ArchiveT> static ClassName Deserialize(ArchiveT &ar);
 ///                     template <typename ArchiveT, typename CharT, typename TraitsT> static ClassName Deserialize(std::basic_istream<CharT, TraitsT> &s);
 ///                     template <typename ArchiveT, typename CharT, typename TraitsT> static ClassName Deserialize(std::basic_streambuf<CharT, TraitsT> &s);
+///                     template <typename ArchiveT> ArchiveSession<ArchiveT> & Serialize(ArchiveSession<ArchiveT> &session) const;     // See ArchiveSession.h
+///                     template <typename ArchiveT> static ClassName Deserialize(ArchiveSession<ArchiveT> &session);                   // See ArchiveSession.h
+///
+///                 When std::span is available (C++20), the following methods will be created as well;
+///                 they read from and write to caller-provided buffers without allocating memory:
+///
+///                     template <typename ArchiveT> size_t Serialize(std::span<std::byte> data) const; // Returns the number of bytes written; throws std::length_error if the buffer is too small
+///                     template <typename ArchiveT> static ClassName Deserialize(std::span<std::byte const> data);
+///
+///                 When SERIALIZATION_DESERIALIZE_INTO is provided, DeserializeInto methods
+///                 that reuse the storage of an existing object will be created as well.
+///
+///                 When SERIALIZATION_DELTA is provided, SerializeDelta and ApplyDelta methods
+///                 that write and read only the members that differ from a baseline object will
+///                 be created as well.
 ///
 ///                 If the object is polymorphic, the following methods will be created as well:
 ///
@@ -99,6 +161,45 @@ namespace Serialization {
 ///                     template <typename ArchiveT, typename CharT, typename TraitsT> static std::unique_ptr<PolymorphicBaseName> DeserializePtr(std::basic_istream<CharT, TraitsT> &s);
 ///                     template <typename ArchiveT, typename CharT, typename TraitsT> static std::unique_ptr<PolymorphicBaseName> DeserializePtr(std::basic_streambuf<CharT, TraitsT> &s);
 ///
+///                 When std::pmr is available, polymorphic objects that aren't SharedObjects also have the
+///                 following methods; the new object, along with the intermediate data created while it is
+///                 deserialized, is allocated from the provided memory resource:
+///
+///                     template <typename ArchiveT> static ArenaUniquePtr<PolymorphicBaseName> DeserializePtr(ArchiveT &ar, std::pmr::memory_resource &resource);
+///                     template <typename ArchiveT, typename CharT, typename TraitsT> static ArenaUniquePtr<PolymorphicBaseName> DeserializePtr(std::basic_istream<CharT, TraitsT> &s, std::pmr::memory_resource &resource);
+///                     template <typename ArchiveT, typename CharT, typename TraitsT> static ArenaUniquePtr<PolymorphicBaseName> DeserializePtr(std::basic_streambuf<CharT, TraitsT> &s, std::pmr::memory_resource &resource);
+///
+///                 SerializedSizeUpperBound is the number of bytes written for the object (not
+///                 including the archive header) by archives that serialize fundamental types
+///                 as raw bytes (e.g. boost::archive::binary_oarchive) when all members have a
+///                 fixed-size encoding; it is Details::UnboundedSerializedSize otherwise.
+///                 GetSerializedSize uses this value when available and only serializes the
+///                 object when it isn't.
+///
+///                 The following type is created as well; it describes the data serialized
+///                 for the object so that it can be processed at compile time (see SchemaField):
+///
+///                     struct SerializationSchema {
+///                         using Type = ClassName;
+///                         using BaseTypes = std::tuple<BaseClassNames...>;
+///                         static constexpr char const * const TypeName;
+///                         static constexpr size_t const NumFields;
+///                         static constexpr bool const IsCustom;                                   // True if SERIALIZATION_DATA_CUSTOM_TYPES was provided (and no fields are described)
+///                         static constexpr unsigned int const Version;                            // See SERIALIZATION_VERSION
+///                         static constexpr unsigned int const FormatFlags;                        // SchemaFormatFlag values for the flags that change the serialized format
+///                         static constexpr std::tuple<SchemaField<ClassName, MemberTypes, ...>...> GetFields(void);
+///                     };
+///
+///                 GetSchemaFingerprint returns a 64-bit value computed from this
+///                 description at compile time, which can be used to determine if
+///                 peers were built with compatible versions of a class.
+///
+///                 The SerializeData and DeserializeData types used to write and read the
+///                 object are never tracked, but the class itself uses boost's default
+///                 tracking (track_selectively). Objects reached through pointers (for example,
+///                 std::shared_ptr members) are tracked by address, so an object referenced by
+///                 multiple pointers is written once and restored as a single shared object.
+///
 ///                 The following methods will be called if they exist:
 ///                     void DeserializeFinalConstruct(void);
 ///                     void FinalConstruct(void);
@@ -129,6 +230,13 @@ namespace Serialization {
 /// with the SERIALIZATION_ABSTRACT flag.
 #define SERIALIZATION_DATA_ONLY                         4
 
+/// Serializes objects within a polymorphic hierarchy via SerializePtr and DeserializePtr using
+/// a small integer id (provided by SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID) rather than the
+/// class name used by boost. This flag applies to the entire hierarchy and may only be used
+/// with SERIALIZATION_ABSTRACT or SERIALIZATION_POLYMORPHIC_BASE; see SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID
+/// for more information.
+#define SERIALIZATION_POLYMORPHIC_TYPE_IDS              8
+
 // ----------------------------------------------------------------------
 // |  Data-based flags
 
@@ -164,7 +272,96 @@ namespace Serialization {
 ///
 #define SERIALIZATION_DATA_CUSTOM_TYPES                 6
 
-#define __NUM_SERIALIZATION_FLAGS                       7
+/// Serialize local data as a single block of bytes when the archive writes fundamental
+/// types as raw bytes (for example, boost::archive::binary_oarchive); all other archives
+/// continue to serialize data member-by-member. For members of fundamental and enum types,
+/// the output is identical to that produced by member-by-member serialization with these
+/// archives (enums are written as ints, regardless of their underlying type), but the
+/// per-member archive dispatch is avoided.
+///
+/// All members must be trivially copyable (and may not be raw pointers), and the class
+/// may not have BASES or be used with SERIALIZATION_DATA_CUSTOM_TYPES; these requirements
+/// are validated at compile time.
+///
+/// See SERIALIZATION_BITWISE_DECLARE for information on serializing collections of these
+/// objects via a single memory copy.
+///
+#define SERIALIZATION_DATA_BITWISE                      7
+
+/// Versions the data serialized for the class, so that members can be added without invalidating
+/// existing archives (see SERIALIZATION_MEMBERS_SINCE). The version is written by boost the first
+/// time that an object of the class is encountered within an archive rather than with each object,
+/// and loading an archive written with a newer version of the class throws an exception.
+///
+/// Version must be an integer literal between 1 and 255. This flag may not be used with
+/// SERIALIZATION_DATA_CUSTOM_TYPES or SERIALIZATION_DATA_BITWISE. Note that adding this flag to
+/// a class changes its serialized format.
+///
+#define SERIALIZATION_VERSION(Version)                  (9, Version)
+
+/// Members added to a class declared with SERIALIZATION_VERSION, where each entry is a tuple in the
+/// form `(Member, Version)` or `(Member, Version, DefaultValue)`. Members aren't read from archives
+/// written with an older version of the class; they are set to DefaultValue (or value-initialized)
+/// instead.
+///
+///     SERIALIZATION(
+///         MyObj,
+///         MEMBERS(a, b, c),
+///         FLAGS(SERIALIZATION_VERSION(3), SERIALIZATION_MEMBERS_SINCE((b, 2), (c, 3, "default")))
+///     );
+///
+#define SERIALIZATION_MEMBERS_SINCE(...)                (10, (__VA_ARGS__))
+
+/// Creates DeserializeInto methods that deserialize content into an existing object rather than
+/// creating a new one, so that the storage of members such as std::vector and std::string is reused
+/// when objects of the class are deserialized in a loop:
+///
+///     template <typename ArchiveT> static void DeserializeInto(ArchiveT &ar, ClassName &obj);
+///     template <typename ArchiveT, typename CharT, typename TraitsT> static void DeserializeInto(std::basic_istream<CharT, TraitsT> &s, ClassName &obj);
+///
+/// The object's members (and the members of its bases) are moved into the DeserializeData before it
+/// is read and the object is assigned a new object constructed from that data, so DeserializeFinalConstruct
+/// and FinalConstruct are invoked just as they are for Deserialize. The content read is the same as
+/// the content read by Deserialize.
+///
+/// The class must be move assignable. If an exception is thrown, the object is left with the
+/// moved-from values of its members.
+///
+#define SERIALIZATION_DESERIALIZE_INTO                  11
+
+/// Creates methods that write and read the differences between an object and a baseline object
+/// (for example, the last state sent to a peer) rather than the entire object:
+///
+///     template <typename ArchiveT> ArchiveT & SerializeDelta(ArchiveT &ar, ClassName const &baseline) const;
+///     template <typename ArchiveT, typename CharT, typename TraitsT> std::basic_ostream<CharT, TraitsT> & SerializeDelta(std::basic_ostream<CharT, TraitsT> &s, ClassName const &baseline) const;
+///     template <typename ArchiveT> static void ApplyDelta(ArchiveT &ar, ClassName &obj);
+///     template <typename ArchiveT, typename CharT, typename TraitsT> static void ApplyDelta(std::basic_istream<CharT, TraitsT> &s, ClassName &obj);
+///
+/// A bitmap of the members that have changed (one byte for every 8 members) is written for each
+/// class in the hierarchy (bases are written first), followed by the changed members. Nested
+/// SERIALIZATION members are written as deltas of their own, objects referenced by smart pointers
+/// are compared by value (objects of polymorphic types are always written when present), and all
+/// other members are compared with operator==. The only members written for an unchanged object
+/// are the bitmaps.
+///
+/// ApplyDelta must be invoked with an object equal to the baseline used to write the delta. It
+/// reads the changed members into a DeserializeData, moves the object's unchanged members into that
+/// data, and assigns the object a new object constructed from it (see SERIALIZATION_DESERIALIZE_INTO),
+/// so DeserializeFinalConstruct and FinalConstruct are invoked for the updated object.
+///
+/// The entire delta is read before any of the object's members are moved, so the object is left
+/// unchanged if the delta is truncated or corrupt. If an exception is thrown while the updated object
+/// is constructed (for example, by DeserializeFinalConstruct or FinalConstruct), the object is left
+/// with the moved-from values of its unchanged members.
+///
+/// The class must be move assignable and have at most 64 members. This flag may not be used with
+/// SERIALIZATION_DATA_ONLY, SERIALIZATION_ABSTRACT, or SERIALIZATION_SHARED_OBJECT, and the class
+/// (along with its bases and nested SERIALIZATION members) may not use SERIALIZATION_DATA_CUSTOM_TYPES
+/// or contain raw pointers.
+///
+#define SERIALIZATION_DELTA                             12
+
+#define __NUM_SERIALIZATION_FLAGS                       13
 
 /////////////////////////////////////////////////////////////////////////
 ///  \def           SERIALIZATION_POLYMORPHIC_DECLARE
@@ -184,6 +381,12 @@ namespace Serialization {
 ///                 Note that this macro must appear after the object has been declared,
 ///                 and must appear in the root namespace.
 ///
+///                 SERIALIZATION_POLYMORPHIC_DEFINE registers the type (and its bases)
+///                 with boost during static initialization. Once main has been entered,
+///                 serializing objects doesn't modify any state shared between archives,
+///                 so objects can be serialized and deserialized concurrently on any
+///                 number of threads (provided that each thread uses its own archive).
+///
 #define SERIALIZATION_POLYMORPHIC_DECLARE(FullyQualifiedObjectName)         SERIALIZATION_POLYMORPHIC_DECLARE_Impl(FullyQualifiedObjectName)
 
 /////////////////////////////////////////////////////////////////////////
@@ -199,6 +402,43 @@ namespace Serialization {
 ///
 #define SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(FullyQualifiedObjectName)      SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_Impl(FullyQualifiedObjectName)
 
+/////////////////////////////////////////////////////////////////////////
+///  \def           SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID
+///  \brief         Used in place of SERIALIZATION_POLYMORPHIC_DECLARE for concrete
+///                 types within a hierarchy whose root is declared with the
+///                 SERIALIZATION_POLYMORPHIC_TYPE_IDS flag. SerializePtr writes the
+///                 id rather than the class name used by boost, and DeserializePtr
+///                 uses the id to index into a table of the types registered by
+///                 SERIALIZATION_POLYMORPHIC_DEFINE.
+///
+///                 Ids must be unique within the hierarchy and must not change once
+///                 data has been persisted. Ids are stored in a flat table, so small,
+///                 densely packed values should be used.
+///
+///                 Usage:
+///                     struct Base {
+///                         SERIALIZATION(Base, FLAGS(SERIALIZATION_ABSTRACT, SERIALIZATION_POLYMORPHIC_TYPE_IDS));
+///                     };
+///
+///                     struct Derived : public Base {
+///                         SERIALIZATION(Derived, BASES(Base), FLAGS(SERIALIZATION_POLYMORPHIC(Base)));
+///                     };
+///
+///                     SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Base);
+///                     SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_WITH_ID(Derived, 1);
+///
+///                 Objects serialized as members (for example, std::unique_ptr<Base>)
+///                 continue to use boost's class names.
+///
+#define SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID(FullyQualifiedObjectName, Id)     SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID_Impl(FullyQualifiedObjectName, Id)
+
+/////////////////////////////////////////////////////////////////////////
+///  \def           SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_WITH_ID
+///  \brief         Invokes SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID and
+///                 SERIALIZATION_POLYMORPHIC_DEFINE.
+///
+#define SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_WITH_ID(FullyQualifiedObjectName, Id)      SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_WITH_ID_Impl(FullyQualifiedObjectName, Id)
+
 /////////////////////////////////////////////////////////////////////////
 ///  \def           SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS
 ///  \brief         It is unusual to have to use this macro, but it may be necessary
@@ -229,6 +469,31 @@ namespace Serialization {
 ///
 #define SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS(Name, ...)          SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS_Impl(Name, __VA_ARGS__)
 
+/////////////////////////////////////////////////////////////////////////
+///  \def           SERIALIZATION_BITWISE_DECLARE
+///  \brief         Marks a class declared with the SERIALIZATION_DATA_BITWISE
+///                 flag as bitwise serializable (boost::serialization::is_bitwise_serializable),
+///                 which allows collections of the class (for example, std::vector)
+///                 to be saved and loaded via a single memory copy with archives
+///                 that support it.
+///
+///                 The class must be trivially copyable and default constructible,
+///                 as boost default constructs the elements of a collection before
+///                 copying data into them. The class must also be free of padding
+///                 and all of its data members must be listed in MEMBERS (the size
+///                 of the class must equal the sum of its members' sizes), as every
+///                 byte of the object is copied to the archive. Floating point
+///                 members are supported.
+///
+///                 Collections loaded via a single memory copy do not invoke
+///                 Name(DeserializeData &&), DeserializeFinalConstruct, or
+///                 FinalConstruct for their elements.
+///
+///                 Note that this macro must appear after the object has been declared,
+///                 and must appear in the root namespace.
+///
+#define SERIALIZATION_BITWISE_DECLARE(FullyQualifiedObjectName)             SERIALIZATION_BITWISE_DECLARE_Impl(FullyQualifiedObjectName)
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -256,21 +521,31 @@ namespace Serialization {
 #define SERIALIZATION_Impl2_Delay(x)        BOOST_PP_CAT(x, SERIALIZATION_Impl2_Empty())
 #define SERIALIZATION_Impl2_Empty()
 
-#define SERIALIZATION_PreInvoke(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, OptionalPolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes)                  SERIALIZATION_PreInvoke2(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, BOOST_PP_OR(IsAbstract, BOOST_PP_OR(IsPolymorphicBase, BOOST_PP_NOT(BOOST_VMD_IS_NUMBER(OptionalPolymorphicBaseName)))), OptionalPolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes)
-#define SERIALIZATION_PreInvoke2(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, OptionalPolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes)  SERIALIZATION_Invoke(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, BOOST_PP_OR(IsPolymorphicBase, IsPolymorphic)), SERIALIZATION_PreInvoke2_PolymorphicName, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, OptionalPolymorphicBaseName), IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes)
-#define SERIALIZATION_PreInvoke2_PolymorphicName(Name, IsAbstract, IsPolymorphicBase, OptionalPolymorphicBaseName)                                                                                                                          BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_PP_IDENTITY(Name), BOOST_PP_IDENTITY(OptionalPolymorphicBaseName))()
+#define SERIALIZATION_PreInvoke(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, OptionalPolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes, IsBitwise, IsPolymorphicTypeIds, Version, MembersSince, IsDeserializeInto, IsDelta)                  SERIALIZATION_PreInvoke2(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, BOOST_PP_OR(IsAbstract, BOOST_PP_OR(IsPolymorphicBase, BOOST_PP_NOT(BOOST_VMD_IS_NUMBER(OptionalPolymorphicBaseName)))), OptionalPolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes, IsBitwise, IsPolymorphicTypeIds, Version, MembersSince, IsDeserializeInto, IsDelta)
+#define SERIALIZATION_PreInvoke2(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, OptionalPolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes, IsBitwise, IsPolymorphicTypeIds, Version, MembersSince, IsDeserializeInto, IsDelta)  SERIALIZATION_Invoke(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, BOOST_PP_OR(IsPolymorphicBase, IsPolymorphic)), SERIALIZATION_PreInvoke2_PolymorphicName, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, OptionalPolymorphicBaseName), IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes, IsBitwise, IsPolymorphicTypeIds, BOOST_PP_BOOL(Version), Version, BOOST_VMD_IS_TUPLE(MembersSince), MembersSince, IsDeserializeInto, IsDelta)
+#define SERIALIZATION_PreInvoke2_PolymorphicName(Name, IsAbstract, IsPolymorphicBase, OptionalPolymorphicBaseName)                                                                                                                                   BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_PP_IDENTITY(Name), BOOST_PP_IDENTITY(OptionalPolymorphicBaseName))()
 
 // ----------------------------------------------------------------------
-#define SERIALIZATION_Invoke(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes)                  \
-    public:                                                                                                                                                                                                                                     \
-        SERIALIZATION_Impl_PODImpl(Name, HasMembers, Members, HasBases, Bases, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes)                            \
-                                                                                                                                                                                                                                                \
-        Name(typename SerializationPOD::DeserializeData && data)                                                                                                                                                                                \
-            BOOST_PP_IIF(HasCustomLocalDataTypes, SERIALIZATION_Invoke_CustomCtor, SERIALIZATION_Invoke_DefaultCtor)(Name, HasMembers, Members, HasBases, Bases)                                                                                \
-                                                                                                                                                                                                                                                \
-        BOOST_PP_IIF(BOOST_PP_OR(IsDataOnly, BOOST_PP_OR(IsAbstract, IsSharedObject)), BOOST_VMD_EMPTY, SERIALIZATION_Invoke_Methods)(Name)                                                                                                     \
-        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), IsSharedObject), SERIALIZATION_Invoke_PtrMethods_SharedObject, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName)                            \
-        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), BOOST_PP_AND(BOOST_PP_NOT(IsSharedObject), IsPolymorphic)), SERIALIZATION_Invoke_PtrMethods_Polymorphic, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName) \
+#define SERIALIZATION_Invoke(Name, HasMembers, Members, HasBases, Bases, IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes, IsBitwise, IsPolymorphicTypeIds, IsVersioned, Version, HasMembersSince, MembersSince, IsDeserializeInto, IsDelta) \
+    public:                                                                                                                                                                                                                                                                                                                                      \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(IsPolymorphicTypeIds, BOOST_PP_NOT(BOOST_PP_OR(IsAbstract, IsPolymorphicBase))), false, true), "SERIALIZATION_POLYMORPHIC_TYPE_IDS can only be used with SERIALIZATION_ABSTRACT or SERIALIZATION_POLYMORPHIC_BASE");                                                                             \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(IsPolymorphicTypeIds, IsSharedObject), false, true), "SERIALIZATION_POLYMORPHIC_TYPE_IDS cannot be used with SERIALIZATION_SHARED_OBJECT");                                                                                                                                                      \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(IsVersioned, BOOST_PP_OR(HasCustomLocalDataTypes, IsBitwise)), false, true), "SERIALIZATION_VERSION cannot be used with SERIALIZATION_DATA_CUSTOM_TYPES or SERIALIZATION_DATA_BITWISE");                                                                                                         \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(HasMembersSince, BOOST_PP_NOT(IsVersioned)), false, true), "SERIALIZATION_MEMBERS_SINCE requires SERIALIZATION_VERSION");                                                                                                                                                                        \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(IsDeserializeInto, BOOST_PP_OR(IsDataOnly, BOOST_PP_OR(IsAbstract, IsSharedObject))), false, true), "SERIALIZATION_DESERIALIZE_INTO cannot be used with SERIALIZATION_DATA_ONLY, SERIALIZATION_ABSTRACT, or SERIALIZATION_SHARED_OBJECT");                                                       \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(IsDelta, BOOST_PP_OR(IsDataOnly, BOOST_PP_OR(IsAbstract, IsSharedObject))), false, true), "SERIALIZATION_DELTA cannot be used with SERIALIZATION_DATA_ONLY, SERIALIZATION_ABSTRACT, or SERIALIZATION_SHARED_OBJECT");                                                                            \
+                                                                                                                                                                                                                                                                                                                                                 \
+        SERIALIZATION_Impl_PODImpl(Name, HasMembers, Members, HasBases, Bases, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes, IsBitwise, IsPolymorphicTypeIds, IsVersioned, Version, HasMembersSince, MembersSince)                                       \
+        SERIALIZATION_Impl_Schema(Name, BOOST_PP_AND(HasMembers, BOOST_PP_NOT(HasCustomLocalDataTypes)), Members, HasBases, Bases, HasCustomLocalDataTypes, Version, SERIALIZATION_Impl_Schema_FormatFlags(IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, IsBitwise, IsPolymorphicTypeIds, HasCustomLocalDataTypes))              \
+                                                                                                                                                                                                                                                                                                                                                 \
+        Name(typename SerializationPOD::DeserializeData && data)                                                                                                                                                                                                                                                                                 \
+            BOOST_PP_IIF(HasCustomLocalDataTypes, SERIALIZATION_Invoke_CustomCtor, SERIALIZATION_Invoke_DefaultCtor)(Name, HasMembers, Members, HasBases, Bases)                                                                                                                                                                                 \
+                                                                                                                                                                                                                                                                                                                                                 \
+        BOOST_PP_IIF(BOOST_PP_OR(IsDataOnly, BOOST_PP_OR(IsAbstract, IsSharedObject)), BOOST_VMD_EMPTY, SERIALIZATION_Invoke_Methods)(Name)                                                                                                                                                                                                      \
+        BOOST_PP_IIF(BOOST_PP_AND(IsDeserializeInto, BOOST_PP_NOT(BOOST_PP_OR(IsDataOnly, BOOST_PP_OR(IsAbstract, IsSharedObject)))), SERIALIZATION_Invoke_DeserializeInto, BOOST_VMD_EMPTY)(Name)                                                                                                                                               \
+        BOOST_PP_IIF(BOOST_PP_AND(IsDelta, BOOST_PP_NOT(BOOST_PP_OR(IsDataOnly, BOOST_PP_OR(IsAbstract, IsSharedObject)))), SERIALIZATION_Invoke_Delta, BOOST_VMD_EMPTY)(Name)                                                                                                                                                                   \
+        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), IsSharedObject), SERIALIZATION_Invoke_PtrMethods_SharedObject, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName)                                                                                                                             \
+        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), BOOST_PP_AND(BOOST_PP_NOT(IsSharedObject), IsPolymorphic)), SERIALIZATION_Invoke_PtrMethods_Polymorphic, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)                                                                                                  \
 
 #define SERIALIZATION_Invoke_CustomCtor(Name, HasMembers, Members, HasBases, Base)  ;
 
@@ -292,11 +567,15 @@ namespace Serialization {
 #define SERIALIZATION_Invoke_DefaultCtor_Members(Name, Members)             BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Invoke_DefaultCtor_Members_Macro, Name, Members)
 #define SERIALIZATION_Invoke_DefaultCtor_Members_Macro(r, Name, Member)     Member(BoostHelpers::Serialization::Details::CreateMember<decltype(Name::Member)>(std::move(data.local. Member)))
 
+#if (defined SERIALIZATION_STATS)
+#   define SERIALIZATION_Stats_Call(Name, Operation)                    BoostHelpers::Serialization::Details::SerializationStatsCallScope const serializationStatsCallScope(BoostHelpers::Serialization::Details::GetSerializationStatsCounters<Name>(BOOST_PP_STRINGIZE(Name)), BoostHelpers::Serialization::SerializationOperation::Operation);
+#   define SERIALIZATION_Stats_Bytes(Name, Operation, Stream)           BoostHelpers::Serialization::Details::SerializationStatsBytesScope<CharT, TraitsT> const serializationStatsBytesScope(BoostHelpers::Serialization::Details::GetSerializationStatsCounters<Name>(BOOST_PP_STRINGIZE(Name)), BoostHelpers::Serialization::SerializationOperation::Operation, Stream);
+#else
+#   define SERIALIZATION_Stats_Call(Name, Operation)
+#   define SERIALIZATION_Stats_Bytes(Name, Operation, Stream)
+#endif
+
 #define SERIALIZATION_Invoke_Methods(Name)                                                                              \
-    SerializationPOD CreateSerializationPOD(void) const {                                                               \
-        return SerializationPOD(*this);                                                                                 \
-    }                                                                                                                   \
-                                                                                                                        \
     template <typename ArchiveT>                                                                                        \
     ArchiveT & Serialize(ArchiveT &ar) const {                                                                          \
         return Serialize(ar, BOOST_PP_STRINGIZE(Name));                                                                 \
@@ -304,9 +583,11 @@ namespace Serialization {
                                                                                                                         \
     template <typename ArchiveT>                                                                                        \
     ArchiveT & Serialize(ArchiveT &ar, char const *tag) const {                                                         \
-        SerializationPOD const              pod(CreateSerializationPOD());                                              \
+        SERIALIZATION_Stats_Call(Name, Serialize)                                                                       \
+                                                                                                                        \
+        SerializationPOD::SerializeData const           data(*this);                                                    \
                                                                                                                         \
-        ar << boost::serialization::make_nvp(tag, pod);                                                                 \
+        BoostHelpers::Serialization::Details::SaveNamed(ar, tag, data);                                                 \
         return ar;                                                                                                      \
     }                                                                                                                   \
                                                                                                                         \
@@ -317,6 +598,8 @@ namespace Serialization {
                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                      \
     std::basic_ostream<CharT, TraitsT> & Serialize(std::basic_ostream<CharT, TraitsT> &s, char const *tag) const {      \
+        SERIALIZATION_Stats_Bytes(Name, Serialize, s)                                                                   \
+                                                                                                                        \
         ArchiveT                            ar(s);                                                                      \
                                                                                                                         \
         Serialize(ar, tag);                                                                                             \
@@ -330,6 +613,8 @@ namespace Serialization {
                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                      \
     std::basic_streambuf<CharT, TraitsT> & Serialize(std::basic_streambuf<CharT, TraitsT> &s, char const *tag) const {  \
+        SERIALIZATION_Stats_Bytes(Name, Serialize, s)                                                                   \
+                                                                                                                        \
         ArchiveT                            ar(s);                                                                      \
                                                                                                                         \
         Serialize(ar, tag);                                                                                             \
@@ -337,26 +622,43 @@ namespace Serialization {
     }                                                                                                                   \
                                                                                                                         \
     template <typename ArchiveT>                                                                                        \
-    size_t GetSerializedSize(void) const {                                                                              \
-        boost::iostreams::filtering_ostream out(boost::iostreams::counter() | boost::iostreams::null_sink());           \
+    BoostHelpers::Serialization::ArchiveSession<ArchiveT> & Serialize(                                                  \
+        BoostHelpers::Serialization::ArchiveSession<ArchiveT> &session                                                  \
+    ) const {                                                                                                           \
+        auto const                          message(session.template BeginMessage<Name>());                             \
+                                                                                                                        \
+        Serialize(message.GetArchive());                                                                                \
+        return session;                                                                                                 \
+    }                                                                                                                   \
                                                                                                                         \
-        Serialize<ArchiveT>(out);                                                                                       \
-        out.flush();                                                                                                    \
+    template <typename ArchiveT>                                                                                        \
+    static constexpr size_t const SerializedSizeUpperBound = SerializationPOD::SerializedSizeUpperBound<ArchiveT>;      \
                                                                                                                         \
-        return static_cast<size_t>(out.component<boost::iostreams::counter>(0)->characters());                          \
+    template <typename ArchiveT>                                                                                        \
+    size_t GetSerializedSize(void) const {                                                                              \
+        return BoostHelpers::Serialization::Details::GetSerializedSize<ArchiveT>(*this);                                \
     }                                                                                                                   \
                                                                                                                         \
     template <typename ArchiveT>                                                                                        \
-    static Name Deserialize(ArchiveT ar) {                                                                              \
+    static Name Deserialize(ArchiveT &ar) {                                                                             \
         return Deserialize(ar, BOOST_PP_STRINGIZE(Name));                                                               \
     }                                                                                                                   \
                                                                                                                         \
     template <typename ArchiveT>                                                                                        \
     static Name Deserialize(ArchiveT &ar, char const *tag) {                                                            \
-        SerializationPOD                    pod;                                                                        \
+        SERIALIZATION_Stats_Call(Name, Deserialize)                                                                     \
                                                                                                                         \
-        ar >> boost::serialization::make_nvp(tag, pod);                                                                 \
-        return Name(pod.Construct());                                                                                   \
+        SerializationPOD::DeserializeData               data;                                                           \
+                                                                                                                        \
+        BoostHelpers::Serialization::Details::LoadNamed(ar, tag, data);                                                 \
+        return Name(std::move(data));                                                                                   \
+    }                                                                                                                   \
+                                                                                                                        \
+    template <typename ArchiveT>                                                                                        \
+    static Name Deserialize(BoostHelpers::Serialization::ArchiveSession<ArchiveT> &session) {                           \
+        auto const                          message(session.template BeginMessage<Name>());                             \
+                                                                                                                        \
+        return Deserialize(message.GetArchive());                                                                       \
     }                                                                                                                   \
                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                      \
@@ -366,6 +668,8 @@ namespace Serialization {
                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                      \
     static Name Deserialize(std::basic_istream<CharT, TraitsT> &s, char const *tag) {                                   \
+        SERIALIZATION_Stats_Bytes(Name, Deserialize, s)                                                                 \
+                                                                                                                        \
         ArchiveT                            ar(s);                                                                      \
                                                                                                                         \
         return Deserialize(ar, tag);                                                                                    \
@@ -378,11 +682,99 @@ namespace Serialization {
                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                      \
     static Name Deserialize(std::basic_streambuf<CharT, TraitsT> &s, char const *tag) {                                 \
+        SERIALIZATION_Stats_Bytes(Name, Deserialize, s)                                                                 \
+                                                                                                                        \
         ArchiveT                            ar(s);                                                                      \
                                                                                                                         \
         return Deserialize(ar, tag);                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    SERIALIZATION_Invoke_Methods_Span(Name)
+
+#if (defined __cpp_lib_span)
+#   define SERIALIZATION_Invoke_Methods_Span(Name)                                                                      \
+    template <typename ArchiveT>                                                                                        \
+    size_t Serialize(std::span<std::byte> data) const {                                                                 \
+        return BoostHelpers::Serialization::Details::SerializeToBuffer<ArchiveT>(*this, data.data(), data.size());      \
+    }                                                                                                                   \
+                                                                                                                        \
+    template <typename ArchiveT>                                                                                        \
+    static Name Deserialize(std::span<std::byte const> data) {                                                          \
+        return BoostHelpers::Serialization::Details::DeserializeFromBuffer<ArchiveT, Name>(data.data(), data.size());   \
+    }
+#else
+#   define SERIALIZATION_Invoke_Methods_Span(Name)
+#endif
+
+#define SERIALIZATION_Invoke_DeserializeInto(Name)                                                                                  \
+    template <typename ArchiveT>                                                                                                    \
+    static void DeserializeInto(ArchiveT &ar, Name &obj) {                                                                          \
+        DeserializeInto(ar, obj, BOOST_PP_STRINGIZE(Name));                                                                         \
+    }                                                                                                                               \
+                                                                                                                                    \
+    template <typename ArchiveT>                                                                                                    \
+    static void DeserializeInto(ArchiveT &ar, Name &obj, char const *tag) {                                                         \
+        static_assert(std::is_move_assignable_v<Name>, "SERIALIZATION_DESERIALIZE_INTO requires classes that are move assignable"); \
+                                                                                                                                    \
+        SerializationPOD::DeserializeData               data;                                                                       \
+                                                                                                                                    \
+        SerializationPOD::LendStorage(obj, data);                                                                                   \
+                                                                                                                                    \
+        BoostHelpers::Serialization::Details::LoadNamed(ar, tag, data);                                                             \
+        obj = Name(std::move(data));                                                                                                \
+    }                                                                                                                               \
+                                                                                                                                    \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                  \
+    static void DeserializeInto(std::basic_istream<CharT, TraitsT> &s, Name &obj) {                                                 \
+        DeserializeInto<ArchiveT>(s, obj, BOOST_PP_STRINGIZE(Name));                                                                \
+    }                                                                                                                               \
+                                                                                                                                    \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                  \
+    static void DeserializeInto(std::basic_istream<CharT, TraitsT> &s, Name &obj, char const *tag) {                                \
+        ArchiveT                            ar(s);                                                                                  \
+                                                                                                                                    \
+        DeserializeInto(ar, obj, tag);                                                                                              \
     }
 
+#define SERIALIZATION_Invoke_Delta(Name)                                                                                            \
+    template <typename ArchiveT>                                                                                                    \
+    ArchiveT & SerializeDelta(ArchiveT &ar, Name const &baseline) const {                                                           \
+        SerializationPOD::SaveDelta(ar, *this, baseline);                                                                           \
+        return ar;                                                                                                                  \
+    }                                                                                                                               \
+                                                                                                                                    \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                  \
+    std::basic_ostream<CharT, TraitsT> & SerializeDelta(std::basic_ostream<CharT, TraitsT> &s, Name const &baseline) const {        \
+        ArchiveT                            ar(s);                                                                                  \
+                                                                                                                                    \
+        SerializeDelta(ar, baseline);                                                                                               \
+        return s;                                                                                                                   \
+    }                                                                                                                               \
+                                                                                                                                    \
+    template <typename ArchiveT>                                                                                                    \
+    static void ApplyDelta(ArchiveT &ar, Name &obj) {                                                                               \
+        static_assert(std::is_move_assignable_v<Name>, "SERIALIZATION_DELTA requires classes that are move assignable");            \
+                                                                                                                                    \
+        SerializationPOD::DeserializeData               data;                                                                       \
+        std::vector<std::uint64_t>                      masks;                                                                      \
+        size_t                                          maskIndex(0);                                                               \
+                                                                                                                                    \
+        /* The entire delta is read before any of the object's members are moved, so */                                             \
+        /* the object is unchanged if the delta can't be read. */                                                                   \
+        SerializationPOD::LoadDelta(ar, data, masks);                                                                               \
+        SerializationPOD::LendDeltaStorage(obj, data, masks, maskIndex);                                                            \
+                                                                                                                                    \
+        obj = Name(std::move(data));                                                                                                \
+    }                                                                                                                               \
+                                                                                                                                    \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                  \
+    static void ApplyDelta(std::basic_istream<CharT, TraitsT> &s, Name &obj) {                                                      \
+        ArchiveT                            ar(s);                                                                                  \
+                                                                                                                                    \
+        ApplyDelta(ar, obj);                                                                                                        \
+    }                                                                                                                               \
+
+
 #define SERIALIZATION_Invoke_PtrMethods_SharedObject(Name, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName)                                                   \
     BOOST_PP_IIF(IsPolymorphic, SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Declare, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)   \
                                                                                                                                                                                 \
@@ -390,24 +782,28 @@ namespace Serialization {
                                                                                                                                                                                 \
     template <typename ArchiveT>                                                                                                                                                \
     ArchiveT & SerializePtr(ArchiveT &ar, char const *tag) const {                                                                                                              \
+        SERIALIZATION_Stats_Call(Name, SerializePtr)                                                                                                                            \
+                                                                                                                                                                                \
         BOOST_PP_IIF(IsPolymorphic, SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Invoke, BOOST_VMD_EMPTY)()                                                        \
         BOOST_PP_IIF(IsPolymorphic, SERIALIZATION_Invoke_PtrMethods_SharedObject_Register, BOOST_VMD_EMPTY)()                                                                   \
                                                                                                                                                                                 \
         PolymorphicSerializationPtr const   ptr(CreateSharedPtr<Name>());                                                                                                       \
                                                                                                                                                                                 \
-        ar << boost::serialization::make_nvp(tag, ptr);                                                                                                                         \
+        BoostHelpers::Serialization::Details::SaveNamed(ar, tag, ptr);                                                                                                          \
         return ar;                                                                                                                                                              \
     }                                                                                                                                                                           \
                                                                                                                                                                                 \
     template <typename ArchiveT>                                                                                                                                                \
     static PolymorphicSerializationPtr DeserializePtr(ArchiveT &ar, char const *tag) {                                                                                          \
+        SERIALIZATION_Stats_Call(Name, DeserializePtr)                                                                                                                          \
+                                                                                                                                                                                \
         PolymorphicSerializationPtr         ptr;                                                                                                                                \
                                                                                                                                                                                 \
-        ar >> boost::serialization::make_nvp(tag, ptr);                                                                                                                         \
+        BoostHelpers::Serialization::Details::LoadNamed(ar, tag, ptr);                                                                                                          \
         return ptr;                                                                                                                                                             \
     }                                                                                                                                                                           \
                                                                                                                                                                                 \
-    SERIALIZATION_Invoke_PtrMethods_Common_Nethods(Name)
+    SERIALIZATION_Invoke_PtrMethods_Common_Nethods(Name, Name)
 
 #define SERIALIZATION_Invoke_PtrMethods_SharedObject_Register()             RegisterSerializationTypes();
 
@@ -422,36 +818,111 @@ namespace Serialization {
             BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_VMD_EMPTY, BOOST_PP_IDENTITY(override))()                                                                                \
                 BOOST_PP_IIF(IsAbstract, SERIALIZATION_Invoke_PtrMethods_Polymorphic_Create_Abstract, SERIALIZATION_Invoke_PtrMethods_Polymorphic_Create_Concrete)(Name, PolymorphicBaseName)       \
                                                                                                                                                                                                     \
+    /* Returns the id provided by SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID (if any) */                                                                                                             \
+    BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_PP_IDENTITY(virtual), BOOST_VMD_EMPTY)()                                                                                         \
+        std::uint32_t GetSerializationPolymorphicTypeId(void) const                                                                                                                                 \
+            BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_VMD_EMPTY, BOOST_PP_IDENTITY(override))()                                                                                \
+                BOOST_PP_IIF(IsAbstract, SERIALIZATION_Invoke_PtrMethods_Polymorphic_TypeId_Abstract, SERIALIZATION_Invoke_PtrMethods_Polymorphic_TypeId_Concrete)()                                \
+                                                                                                                                                                                                    \
     template <typename ArchiveT>                                                                                                                                                                    \
     ArchiveT & SerializePtr(ArchiveT &ar, char const *tag) const {                                                                                                                                  \
+        SERIALIZATION_Stats_Call(Name, SerializePtr)                                                                                                                                                \
+                                                                                                                                                                                                    \
         SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Invoke()                                                                                                                          \
                                                                                                                                                                                                     \
         PolymorphicSerializationPODUniquePtr const      pPod(CreateSerializationPODPtr(*this));                                                                                                     \
                                                                                                                                                                                                     \
-        ar << boost::serialization::make_nvp(tag, pPod);                                                                                                                                            \
+        BoostHelpers::Serialization::Details::SavePolymorphicPtr(ar, tag, *this, pPod);                                                                                                             \
         return ar;                                                                                                                                                                                  \
     }                                                                                                                                                                                               \
                                                                                                                                                                                                     \
     template <typename ArchiveT>                                                                                                                                                                    \
     static PolymorphicSerializationPtr DeserializePtr(ArchiveT &ar, char const *tag) {                                                                                                              \
-        PolymorphicSerializationPODUniquePtr            pPod;                                                                                                                                       \
+        SERIALIZATION_Stats_Call(Name, DeserializePtr)                                                                                                                                              \
+                                                                                                                                                                                                    \
+        PolymorphicSerializationPODUniquePtr const      pPod(BoostHelpers::Serialization::Details::LoadPolymorphicPtr<PolymorphicBaseName::SerializationPOD>(ar, tag));                             \
                                                                                                                                                                                                     \
-        ar >> boost::serialization::make_nvp(tag, pPod);                                                                                                                                            \
         return pPod->ConstructPtr();                                                                                                                                                                \
     }                                                                                                                                                                                               \
                                                                                                                                                                                                     \
-    SERIALIZATION_Invoke_PtrMethods_Common_Nethods(PolymorphicBaseName)
+    SERIALIZATION_Invoke_PtrMethods_Polymorphic_Arena(Name, PolymorphicBaseName)                                                                                                                    \
+                                                                                                                                                                                                    \
+    SERIALIZATION_Invoke_PtrMethods_Common_Nethods(Name, PolymorphicBaseName)
+
+#if (defined __cpp_lib_memory_resource)
+#   define SERIALIZATION_Invoke_PtrMethods_Polymorphic_Arena(Name, PolymorphicBaseName)                                                                                         \
+    using PolymorphicSerializationArenaPtr              = BoostHelpers::Serialization::ArenaUniquePtr<PolymorphicBaseName>;                                      \
+                                                                                                                                                                 \
+    template <typename ArchiveT>                                                                                                                                 \
+    static PolymorphicSerializationArenaPtr DeserializePtr(ArchiveT &ar, char const *tag, std::pmr::memory_resource &resource) {                                 \
+        SERIALIZATION_Stats_Call(Name, DeserializePtr)                                                                                                           \
+                                                                                                                                                                 \
+        PolymorphicSerializationPODUniquePtr            pPod;                                                                                                    \
+                                                                                                                                                                 \
+        {                                                                                                                                                        \
+            /* The SerializationPOD objects created during deserialization are allocated from the resource as well */                                            \
+            BoostHelpers::Serialization::Details::DeserializationMemoryResourceScope            scope(resource);                                                 \
+                                                                                                                                                                 \
+            try {                                                                                                                                                \
+                pPod = BoostHelpers::Serialization::Details::LoadPolymorphicPtr<PolymorphicBaseName::SerializationPOD>(ar, tag);                                 \
+            }                                                                                                                                                    \
+            catch(...) {                                                                                                                                         \
+                /* Boost doesn't release the objects that it was loading when an exception is thrown */                                                          \
+                scope.ReleaseAllocations();                                                                                                                      \
+                throw;                                                                                                                                           \
+            }                                                                                                                                                    \
+        }                                                                                                                                                        \
+                                                                                                                                                                 \
+        return pPod->ConstructPtr(resource);                                                                                                                     \
+    }                                                                                                                                                            \
+                                                                                                                                                                 \
+    template <typename ArchiveT>                                                                                                                                 \
+    static PolymorphicSerializationArenaPtr DeserializePtr(ArchiveT &ar, std::pmr::memory_resource &resource) {                                                  \
+        return DeserializePtr(ar, SerializationPtrTag, resource);                                                                                                \
+    }                                                                                                                                                            \
+                                                                                                                                                                 \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                               \
+    static PolymorphicSerializationArenaPtr DeserializePtr(std::basic_istream<CharT, TraitsT> &s, std::pmr::memory_resource &resource) {                         \
+        return DeserializePtr<ArchiveT>(s, SerializationPtrTag, resource);                                                                                       \
+    }                                                                                                                                                            \
+                                                                                                                                                                 \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                               \
+    static PolymorphicSerializationArenaPtr DeserializePtr(std::basic_istream<CharT, TraitsT> &s, char const *tag, std::pmr::memory_resource &resource) {        \
+        SERIALIZATION_Stats_Bytes(Name, DeserializePtr, s)                                                                                                       \
+                                                                                                                                                                 \
+        ArchiveT                                        ar(s);                                                                                                   \
+                                                                                                                                                                 \
+        return DeserializePtr(ar, tag, resource);                                                                                                                \
+    }                                                                                                                                                            \
+                                                                                                                                                                 \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                               \
+    static PolymorphicSerializationArenaPtr DeserializePtr(std::basic_streambuf<CharT, TraitsT> &s, std::pmr::memory_resource &resource) {                       \
+        return DeserializePtr<ArchiveT>(s, SerializationPtrTag, resource);                                                                                       \
+    }                                                                                                                                                            \
+                                                                                                                                                                 \
+    template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                               \
+    static PolymorphicSerializationArenaPtr DeserializePtr(std::basic_streambuf<CharT, TraitsT> &s, char const *tag, std::pmr::memory_resource &resource) {      \
+        SERIALIZATION_Stats_Bytes(Name, DeserializePtr, s)                                                                                                       \
+                                                                                                                                                                 \
+        ArchiveT                                        ar(s);                                                                                                   \
+                                                                                                                                                                 \
+        return DeserializePtr(ar, tag, resource);                                                                                                                \
+    }
+#else
+#   define SERIALIZATION_Invoke_PtrMethods_Polymorphic_Arena(Name, PolymorphicBaseName)
+#endif
+
+#define SERIALIZATION_Invoke_PtrMethods_Polymorphic_TypeId_Abstract()                                          = 0;
+#define SERIALIZATION_Invoke_PtrMethods_Polymorphic_TypeId_Concrete()                                          { return SERIALIZATION_POLYMORPHIC_TYPE_ID_Impl_Func_Name() (); }
 
 #define SERIALIZATION_Invoke_PtrMethods_Polymorphic_Create_Abstract(Name, PolymorphicBaseName)                  = 0;
 #define SERIALIZATION_Invoke_PtrMethods_Polymorphic_Create_Concrete(Name, PolymorphicBaseName)                  \
     {                                                                                                           \
         SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Invoke()                                      \
                                                                                                                 \
-        std::unique_ptr<Name::SerializationPOD>         pResult(std::make_unique<SerializationPOD>(*this));     \
+        UNUSED(base);                                                                                           \
                                                                                                                 \
-        pResult->SetOriginalBaseClass(base);                                                                    \
-                                                                                                                \
-        return PolymorphicSerializationPODUniquePtr(pResult.release());                                         \
+        return std::make_unique<SerializationPOD>(*this);                                                       \
     }
 
 #define SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Declare(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)                                                                                                                 \
@@ -462,8 +933,12 @@ namespace Serialization {
                                                                                                                                                                                                                                                     \
         inline static void SERIALIZATION_POLYMORPHIC_DECLARE_Impl_Func_Name() (void);                                                                                                                                                               \
         static void SERIALIZATION_POLYMORPHIC_DEFINE_Impl_Func_Name() (void);                                                                                                                                                                       \
+        inline static std::uint32_t SERIALIZATION_POLYMORPHIC_TYPE_ID_Impl_Func_Name() (void);                                                                                                                                                      \
                                                                                                                                                                                                                                                     \
     public:                                                                                                                                                                                                                                         \
+        /* The class used by RegisterSerializationTypes (see Details::RegisterPolymorphicType) */                                                                                                                                                   \
+        using PolymorphicSerializationBase          = PolymorphicBaseName;                                                                                                                                                                          \
+                                                                                                                                                                                                                                                    \
         /* RegisterSerializationTypes is invoked in Serialization.suffix.h */                                                                                                                                                                       \
         BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_PP_IDENTITY(virtual), BOOST_VMD_EMPTY)()                                                                                                                                     \
             void RegisterSerializationTypes(void) const                                                                                                                                                                                             \
@@ -471,33 +946,34 @@ namespace Serialization {
                     BOOST_PP_IIF(IsAbstract, SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Declare_RegisterAbstract, SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Declare_RegisterConcrete)(Name, PolymorphicBaseName)
 
 #define SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Declare_RegisterAbstract(Name, PolymorphicBaseName)   = 0;
-#define SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Declare_RegisterConcrete(Name, PolymorphicBaseName)   \
-    {                                                                                                                   \
-        boost::serialization::void_cast_register(                                                                       \
-            static_cast<Name const *>(nullptr),                                                                         \
-            static_cast<PolymorphicBaseName const *>(nullptr)                                                           \
-        );                                                                                                              \
-                                                                                                                        \
-        BoostHelpers::Serialization::Details::Access::AdditionalVoidCastRegistration(*this);                            \
+#define SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Declare_RegisterConcrete(Name, PolymorphicBaseName)  \
+    {                                                                                                               \
+        BoostHelpers::Serialization::Details::RegisterPolymorphicType<Name>();                                      \
     }
 
 #define SERIALIZATION_Invoke_PtrMethods_Common_PolymorphicMethods_Invoke()  \
     SERIALIZATION_POLYMORPHIC_DECLARE_Impl_Func_Name() ();                  \
     SERIALIZATION_POLYMORPHIC_DEFINE_Impl_Func_Name() ();
 
-#define SERIALIZATION_Invoke_PtrMethods_Common_Nethods(Name)                                                                                            \
+#define SERIALIZATION_Invoke_PtrMethods_Common_Nethods(Name, TagName)                                                                                   \
+    /* The tag used when one isn't provided, scrubbed once at compile time */                                                                           \
+    static constexpr char const * const     SerializationPtrTag =                                                                                       \
+        BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(BOOST_PP_CAT(TagName, Ptr)));                                   \
+                                                                                                                                                        \
     template <typename ArchiveT>                                                                                                                        \
     ArchiveT & SerializePtr(ArchiveT &ar) const {                                                                                                       \
-        return SerializePtr(ar, BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(BOOST_PP_CAT(Name, Ptr))));             \
+        return SerializePtr(ar, SerializationPtrTag);                                                                                                   \
     }                                                                                                                                                   \
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
     std::basic_ostream<CharT, TraitsT> & SerializePtr(std::basic_ostream<CharT, TraitsT> &s) const {                                                    \
-        return SerializePtr<ArchiveT>(s, BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(BOOST_PP_CAT(Name, Ptr))));    \
+        return SerializePtr<ArchiveT>(s, SerializationPtrTag);                                                                                          \
     }                                                                                                                                                   \
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
     std::basic_ostream<CharT, TraitsT> & SerializePtr(std::basic_ostream<CharT, TraitsT> &s, char const *tag) const {                                   \
+        SERIALIZATION_Stats_Bytes(Name, SerializePtr, s)                                                                                                \
+                                                                                                                                                        \
         ArchiveT                            ar(s);                                                                                                      \
                                                                                                                                                         \
         SerializePtr(ar, tag);                                                                                                                          \
@@ -506,11 +982,13 @@ namespace Serialization {
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
     std::basic_streambuf<CharT, TraitsT> & SerializePtr(std::basic_streambuf<CharT, TraitsT> &s) const {                                                \
-        return SerializePtr<ArchiveT>(s, BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(BOOST_PP_CAT(Name, Ptr))));    \
+        return SerializePtr<ArchiveT>(s, SerializationPtrTag);                                                                                          \
     }                                                                                                                                                   \
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
     std::basic_streambuf<CharT, TraitsT> & SerializePtr(std::basic_streambuf<CharT, TraitsT> &s, char const *tag) const {                               \
+        SERIALIZATION_Stats_Bytes(Name, SerializePtr, s)                                                                                                \
+                                                                                                                                                        \
         ArchiveT                            ar(s);                                                                                                      \
                                                                                                                                                         \
         SerializePtr(ar, tag);                                                                                                                          \
@@ -519,26 +997,23 @@ namespace Serialization {
                                                                                                                                                         \
     template <typename ArchiveT>                                                                                                                        \
     size_t GetSerializedPtrSize(void) const {                                                                                                           \
-        boost::iostreams::filtering_ostream             out(boost::iostreams::counter() | boost::iostreams::null_sink());                               \
-                                                                                                                                                        \
-        SerializePtr<ArchiveT>(out);                                                                                                                    \
-        out.flush();                                                                                                                                    \
-                                                                                                                                                        \
-        return static_cast<size_t>(out.component<boost::iostreams::counter>(0)->characters());                                                          \
+        return BoostHelpers::Serialization::Details::GetSerializedPtrSize<ArchiveT>(*this);                                                             \
     }                                                                                                                                                   \
                                                                                                                                                         \
     template <typename ArchiveT>                                                                                                                        \
     static PolymorphicSerializationPtr DeserializePtr(ArchiveT &ar) {                                                                                   \
-        return DeserializePtr(ar, BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(BOOST_PP_CAT(Name, Ptr))));           \
+        return DeserializePtr(ar, SerializationPtrTag);                                                                                                 \
     }                                                                                                                                                   \
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
     static PolymorphicSerializationPtr DeserializePtr(std::basic_istream<CharT, TraitsT> &s) {                                                          \
-        return DeserializePtr<ArchiveT>(s, BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(BOOST_PP_CAT(Name, Ptr))));  \
+        return DeserializePtr<ArchiveT>(s, SerializationPtrTag);                                                                                        \
     }                                                                                                                                                   \
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
         static PolymorphicSerializationPtr DeserializePtr(std::basic_istream<CharT, TraitsT> &s, char const *tag) {                                     \
+        SERIALIZATION_Stats_Bytes(Name, DeserializePtr, s)                                                                                              \
+                                                                                                                                                        \
         ArchiveT                            ar(s);                                                                                                      \
                                                                                                                                                         \
         return DeserializePtr(ar, tag);                                                                                                                 \
@@ -546,204 +1021,235 @@ namespace Serialization {
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
     static PolymorphicSerializationPtr DeserializePtr(std::basic_streambuf<CharT, TraitsT> &s) {                                                        \
-        return DeserializePtr<ArchiveT>(s, BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(BOOST_PP_CAT(Name, Ptr))));  \
+        return DeserializePtr<ArchiveT>(s, SerializationPtrTag);                                                                                        \
     }                                                                                                                                                   \
                                                                                                                                                         \
     template <typename ArchiveT, typename CharT, typename TraitsT>                                                                                      \
     static PolymorphicSerializationPtr DeserializePtr(std::basic_streambuf<CharT, TraitsT> &s, char const *tag) {                                       \
+        SERIALIZATION_Stats_Bytes(Name, DeserializePtr, s)                                                                                              \
+                                                                                                                                                        \
         ArchiveT                            ar(s);                                                                                                      \
                                                                                                                                                         \
         return DeserializePtr(ar, tag);                                                                                                                 \
     }                                                                                                                                                   \
 
 // ----------------------------------------------------------------------
-#define SERIALIZATION_Impl_PODImpl(Name, HasMembers, Members, HasBases, Bases, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes)    \
-    class SerializationPOD :                                                                                                                                                                                            \
-        public virtual boost::serialization::basic_traits                                                                                                                                                               \
-        BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_BaseClasses, BOOST_VMD_EMPTY)(Bases)                                                                                                                          \
-    {                                                                                                                                                                                                                   \
-    public:                                                                                                                                                                                                             \
-        struct SerializationPODTag {};                                                                                                                                                                                  \
-                                                                                                                                                                                                                        \
-        using level                         = boost::mpl::int_<boost::serialization::object_serializable>;                                                                                                              \
-        using tracking                      = boost::mpl::int_<boost::serialization::track_never>;                                                                                                                      \
-        using version                       = boost::mpl::int_<0>;                                                                                                                                                      \
-        using type_info_implementation      = boost::serialization::extended_type_info_impl<SerializationPOD>;                                                                                                          \
-        using is_wrapper                    = boost::mpl::false_;                                                                                                                                                       \
-                                                                                                                                                                                                                        \
-        BOOST_PP_IIF(HasCustomLocalDataTypes, BOOST_VMD_EMPTY, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes)(Name, HasMembers, Members, HasDeserializeDataCustomCtor)                                               \
-                                                                                                                                                                                                                        \
-        struct SerializeData {                                                                                                                                                                                          \
-            BOOST_PP_IIF(IsPolymorphic, SERIALIZATION_Impl_PODImpl_SerializePolymorphicMembers, BOOST_VMD_EMPTY)(PolymorphicBaseName)                                                                                   \
-                                                                                                                                                                                                                        \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Serialize_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                  \
-            SerializeLocalData const        local;                                                                                                                                                                      \
-                                                                                                                                                                                                                        \
-            SerializeData(Name const &obj) :                                                                                                                                                                            \
-                BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Serialize_Ctor, BOOST_VMD_EMPTY)(Bases)                                                                                                               \
-                local(obj) {                                                                                                                                                                                            \
-            }                                                                                                                                                                                                           \
-                                                                                                                                                                                                                        \
-            SerializeData(SerializeData && other) :                                                                                                                                                                     \
-                BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Serialize_MoveCtor, BOOST_VMD_EMPTY)(Bases)                                                                                                           \
-                local(std::move(make_mutable(other.local)))                                                                                                                                                             \
-            {}                                                                                                                                                                                                          \
-                                                                                                                                                                                                                        \
-            SerializeData & operator =(SerializeData && other) {                                                                                                                                                        \
-                UNUSED(other);                                                                                                                                                                                          \
-                                                                                                                                                                                                                        \
-                BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Serialize_MoveAssign, BOOST_VMD_EMPTY)(Bases)                                                                                                         \
-                make_mutable(local) = std::move(make_mutable(other.local));                                                                                                                                             \
-                                                                                                                                                                                                                        \
-                return *this;                                                                                                                                                                                           \
-            }                                                                                                                                                                                                           \
-                                                                                                                                                                                                                        \
-            SerializeData(SerializeData const &) = delete;                                                                                                                                                              \
-            SerializeData & operator =(SerializeData const &) = delete;                                                                                                                                                 \
-        };                                                                                                                                                                                                              \
-                                                                                                                                                                                                                        \
-        struct DeserializeData {                                                                                                                                                                                        \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Deserialize_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                \
-            DeserializeLocalData            local;                                                                                                                                                                      \
-                                                                                                                                                                                                                        \
-            DeserializeData(void) {                                                                                                                                                                                     \
-            }                                                                                                                                                                                                           \
-                                                                                                                                                                                                                        \
-            DeserializeData(DeserializeData && other) :                                                                                                                                                                 \
-                BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Deserialize_Ctor, BOOST_VMD_EMPTY)(Bases)                                                                                                             \
-                local(std::move(other.local))                                                                                                                                                                           \
-            {}                                                                                                                                                                                                          \
-                                                                                                                                                                                                                        \
-            DeserializeData & operator =(DeserializeData && other) {                                                                                                                                                    \
-                UNUSED(other);                                                                                                                                                                                          \
-                                                                                                                                                                                                                        \
-                BOOST_PP_IIF(HasBases, SERIALIZEATION_Impl_PODImpl_Deserialize_MoveAssign, BOOST_VMD_EMPTY)(Bases)                                                                                                      \
-                local = std::move(other.local);                                                                                                                                                                         \
-                                                                                                                                                                                                                        \
-                return *this;                                                                                                                                                                                           \
-            }                                                                                                                                                                                                           \
-                                                                                                                                                                                                                        \
-            DeserializeData(DeserializeData const &) = delete;                                                                                                                                                          \
-            DeserializeData & operator =(DeserializeData const &) = delete;                                                                                                                                             \
-        };                                                                                                                                                                                                              \
-                                                                                                                                                                                                                        \
-        SerializationPOD(Name const &obj) :                                                                                                                                                                             \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_DelayInitCtor, BOOST_VMD_EMPTY)(Bases)                                                                                                                    \
-            _data_storage(SerializeData(obj))                                                                                                                                                                           \
-        {                                                                                                                                                                                                               \
-            Init(boost::get<SerializeData>(_data_storage));                                                                                                                                                             \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        SerializationPOD(void) :                                                                                                                                                                                        \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_DelayInitCtor, BOOST_VMD_EMPTY)(Bases)                                                                                                                    \
-            _data_storage(DeserializeData())                                                                                                                                                                            \
-        {                                                                                                                                                                                                               \
-            Init(boost::get<DeserializeData>(_data_storage));                                                                                                                                                           \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        SerializationPOD(SerializationPOD && other) :                                                                                                                                                                   \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_DelayInitCtor, BOOST_VMD_EMPTY)(Bases)                                                                                                                    \
-            _data_storage(std::move(make_mutable(other._data_storage)))                                                                                                                                                 \
-        {                                                                                                                                                                                                               \
-            if(SerializeData *pSerializeData = boost::get<SerializeData>(&_data_storage))                                                                                                                               \
-                Init(*pSerializeData);                                                                                                                                                                                  \
-            else if(DeserializeData *pDeserializeData = boost::get<DeserializeData>(&_data_storage))                                                                                                                    \
-                Init(*pDeserializeData);                                                                                                                                                                                \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        SerializationPOD & operator =(SerializationPOD && other) {                                                                                                                                                      \
-            _data_storage = std::move(other._data_storage);                                                                                                                                                             \
-            make_mutable(_pSerializeData) = nullptr;                                                                                                                                                                    \
-            make_mutable(_pDeserializeData) = nullptr;                                                                                                                                                                  \
-                                                                                                                                                                                                                        \
-            if(SerializeData *pSerializeData = boost::get<SerializeData>(&_data_storage))                                                                                                                               \
-                Init(*pSerializeData);                                                                                                                                                                                  \
-            else if(DeserializeData *pDeserializeData = boost::get<DeserializeData>(&_data_storage))                                                                                                                    \
-                Init(*pDeserializeData);                                                                                                                                                                                \
-                                                                                                                                                                                                                        \
-            return *this;                                                                                                                                                                                               \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        SerializationPOD(SerializationPOD const &) = delete;                                                                                                                                                            \
-        SerializationPOD & operator =(SerializationPOD const &) = delete;                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        virtual ~SerializationPOD(void) = default;                                                                                                                                                                      \
-                                                                                                                                                                                                                        \
-        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), BOOST_PP_NOT(IsAbstract)), SERIALIZATION_Impl_PODImpl_Construct, BOOST_VMD_EMPTY)(Name)                                                                     \
-        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), IsPolymorphic), SERIALIZATION_Impl_PODImpl_ConstructPtr, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)                         \
-                                                                                                                                                                                                                        \
-    protected:                                                                                                                                                                                                          \
-        SerializationPOD(BoostHelpers::Serialization::Details::DelayInitTag const &tag)                                                                                                                                 \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_DelayedCtor, BOOST_VMD_EMPTY)(Bases)                                                                                                                      \
-        { UNUSED(tag); }                                                                                                                                                                                                \
-                                                                                                                                                                                                                        \
-        void Init(SerializeData const &data) {                                                                                                                                                                          \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Init, BOOST_VMD_EMPTY)(Bases)                                                                                                                             \
-            const_cast<SerializeData const *&>(_pSerializeData) = &data;                                                                                                                                                \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        void Init(DeserializeData &data) {                                                                                                                                                                              \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Init, BOOST_VMD_EMPTY)(Bases)                                                                                                                             \
-            const_cast<DeserializeData *&>(_pDeserializeData) = &data;                                                                                                                                                  \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-    private:                                                                                                                                                                                                            \
-        friend class boost::serialization::access;                                                                                                                                                                      \
-                                                                                                                                                                                                                        \
-        boost::variant<bool, SerializeData, DeserializeData>                _data_storage;                                                                                                                              \
-        SerializeData const * const                                         _pSerializeData = nullptr;                                                                                                                  \
-        DeserializeData * const                                             _pDeserializeData = nullptr;                                                                                                                \
-                                                                                                                                                                                                                        \
-        DeserializeData MoveDeserializeData(void) {                                                                                                                                                                     \
-            DeserializeData * const         pDeserializeData(boost::get<DeserializeData>(&_data_storage));                                                                                                              \
-                                                                                                                                                                                                                        \
-            if(pDeserializeData == nullptr)                                                                                                                                                                             \
-                throw std::logic_error("DeserializeData has already been moved or never existed");                                                                                                                      \
-                                                                                                                                                                                                                        \
-            DeserializeData                 result(std::move(*pDeserializeData));                                                                                                                                       \
-                                                                                                                                                                                                                        \
-            /* Clear the contents of the storage */                                                                                                                                                                     \
-            boost::variant<bool, SerializeData, DeserializeData>().swap(_data_storage);                                                                                                                                 \
-            return result;                                                                                                                                                                                              \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        BOOST_SERIALIZATION_SPLIT_MEMBER();                                                                                                                                                                             \
-                                                                                                                                                                                                                        \
-        template <typename ArchiveT>                                                                                                                                                                                    \
-        void save(ArchiveT &ar, unsigned int const) const {                                                                                                                                                             \
-            if(_pSerializeData == nullptr)                                                                                                                                                                              \
-                throw std::logic_error("SerializeData is not available");                                                                                                                                               \
-                                                                                                                                                                                                                        \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Serialize, BOOST_VMD_EMPTY)(Bases)                                                                                                                        \
-            _pSerializeData->local.Execute(ar);                                                                                                                                                                         \
-        }                                                                                                                                                                                                               \
-                                                                                                                                                                                                                        \
-        template <typename ArchiveT>                                                                                                                                                                                    \
-        void load(ArchiveT &ar, unsigned int const) {                                                                                                                                                                   \
-            if(_pDeserializeData == nullptr)                                                                                                                                                                            \
-                throw std::logic_error("DeserializeData is not available");                                                                                                                                             \
-                                                                                                                                                                                                                        \
-            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Serialize, BOOST_VMD_EMPTY)(Bases)                                                                                                                        \
-            _pDeserializeData->local.Execute(ar);                                                                                                                                                                       \
-        }                                                                                                                                                                                                               \
+#define SERIALIZATION_Impl_Schema(Name, HasFields, Members, HasBases, Bases, HasCustomLocalDataTypes, VersionValue, Flags)                   \
+    /* Compile-time description of the data serialized for the object (see BoostHelpers::Serialization::SchemaField). */                     \
+    /* Fields are only described when they are serialized by the default implementation (not SERIALIZATION_DATA_CUSTOM_TYPES); */            \
+    /* they are returned by a function, as member pointers can't be formed until the class is complete. */                                   \
+    struct SerializationSchema {                                                                                                             \
+        using Type                          = Name;                                                                                          \
+        using BaseTypes                     = std::tuple<BOOST_PP_IIF(HasBases, BOOST_PP_TUPLE_ENUM, BOOST_VMD_EMPTY)(Bases)>;               \
+                                                                                                                                             \
+        static constexpr char const * const TypeName = BOOST_PP_STRINGIZE(Name);                                                             \
+        static constexpr size_t const NumFields = BOOST_PP_IIF(HasFields, BOOST_PP_TUPLE_SIZE, SERIALIZATION_Impl_Schema_NoFields)(Members); \
+        static constexpr bool const IsCustom = BOOST_PP_IIF(HasCustomLocalDataTypes, true, false);                                           \
+        static constexpr unsigned int const Version = VersionValue;                                                                          \
+        static constexpr unsigned int const FormatFlags = Flags;                                                                             \
+                                                                                                                                             \
+        static constexpr auto GetFields(void) {                                                                                              \
+            return std::make_tuple(BOOST_PP_IIF(HasFields, SERIALIZATION_Impl_Schema_Fields, BOOST_VMD_EMPTY)(Name, Members));               \
+        }                                                                                                                                    \
     };
 
-#define SERIALIZATION_Impl_PODImpl_BaseClasses(Bases)                                   , BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_BaseClasses_Macro, _, Bases)
-#define SERIALIZATION_Impl_PODImpl_BaseClasses_Macro(r, _, Base)                        public Base::SerializationPOD
+#define SERIALIZATION_Impl_Schema_NoFields(Members)                         0
+
+#define SERIALIZATION_Impl_Schema_FormatFlags(IsSharedObject, IsAbstract, IsPolymorphicBase, IsPolymorphic, IsBitwise, IsPolymorphicTypeIds, IsCustom)    \
+    (                                                                                                                                                     \
+        SERIALIZATION_Impl_Schema_FormatFlag(IsSharedObject, SharedObject)                                                                                \
+        | SERIALIZATION_Impl_Schema_FormatFlag(IsAbstract, Abstract)                                                                                      \
+        | SERIALIZATION_Impl_Schema_FormatFlag(IsPolymorphicBase, PolymorphicBase)                                                                        \
+        | SERIALIZATION_Impl_Schema_FormatFlag(IsPolymorphic, Polymorphic)                                                                                \
+        | SERIALIZATION_Impl_Schema_FormatFlag(IsBitwise, Bitwise)                                                                                        \
+        | SERIALIZATION_Impl_Schema_FormatFlag(IsPolymorphicTypeIds, PolymorphicTypeIds)                                                                  \
+        | SERIALIZATION_Impl_Schema_FormatFlag(IsCustom, CustomTypes)                                                                                     \
+    )
+
+#define SERIALIZATION_Impl_Schema_FormatFlag(Condition, Flag)               BOOST_PP_IIF(Condition, static_cast<unsigned int>(BoostHelpers::Serialization::SchemaFormatFlag::Flag), 0u)
+
+#define SERIALIZATION_Impl_Schema_Fields(Name, Members)                     BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_Schema_Fields_Macro, Name, Members)
+#define SERIALIZATION_Impl_Schema_Fields_Macro(r, Name, Member)             BoostHelpers::Serialization::SchemaField<Name, decltype(Name::Member), decltype(&SerializationPOD::DeserializeLocalData::Member)>{ BOOST_PP_STRINGIZE(Member), &Name::Member, &SerializationPOD::DeserializeLocalData::Member }
+
+// ----------------------------------------------------------------------
+#define SERIALIZATION_Impl_PODImpl(Name, HasMembers, Members, HasBases, Bases, IsAbstract, IsPolymorphicBase, IsPolymorphic, PolymorphicBaseName, IsDataOnly, HasDeserializeDataCustomCtor, HasCustomLocalDataTypes, IsBitwise, IsPolymorphicTypeIds, IsVersioned, Version, HasMembersSince, MembersSince)                                                                 \
+    /* Objects are saved via SerializeData and loaded via DeserializeData; SerializationPOD itself only */                                                                                                                                                                                                                                                                 \
+    /* contains data when it is used to serialize a polymorphic object via a pointer to its base class. */                                                                                                                                                                                                                                                                 \
+    class SerializationPOD                                                                                                                                                                                                                                                                                                                                                 \
+        BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_BaseClasses, SERIALIZATION_Impl_PODImpl_RootBaseClass)(Bases)                                                                                                                                                                                                                                                    \
+    {                                                                                                                                                                                                                                                                                                                                                                      \
+    public:                                                                                                                                                                                                                                                                                                                                                                \
+        struct SerializationPODTag {};                                                                                                                                                                                                                                                                                                                                     \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        using level                         = boost::mpl::int_<boost::serialization::object_serializable>;                                                                                                                                                                                                                                                                 \
+        using tracking                      = boost::mpl::int_<boost::serialization::track_never>;                                                                                                                                                                                                                                                                         \
+        using version                       = boost::mpl::int_<0>;                                                                                                                                                                                                                                                                                                         \
+        using type_info_implementation      = boost::serialization::extended_type_info_impl<SerializationPOD>;                                                                                                                                                                                                                                                             \
+        using is_wrapper                    = boost::mpl::false_;                                                                                                                                                                                                                                                                                                          \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        static constexpr bool const IsBitwiseSerializable = BOOST_PP_IIF(IsBitwise, true, false);                                                                                                                                                                                                                                                                          \
+        BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), SERIALIZATION_Impl_PODImpl_PolymorphicTypeIds, BOOST_VMD_EMPTY)(IsPolymorphicTypeIds)                                                                                                                                                                                                                     \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(IsBitwise, HasBases), false, true), "SERIALIZATION_DATA_BITWISE cannot be used with classes that have BASES");                                                                                                                                                                                                             \
+        static_assert(BOOST_PP_IIF(BOOST_PP_AND(IsBitwise, HasCustomLocalDataTypes), false, true), "SERIALIZATION_DATA_BITWISE cannot be used with SERIALIZATION_DATA_CUSTOM_TYPES");                                                                                                                                                                                      \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        BOOST_PP_IIF(HasCustomLocalDataTypes, BOOST_VMD_EMPTY, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes)(Name, HasMembers, Members, HasDeserializeDataCustomCtor, IsBitwise, IsVersioned, Version, HasMembersSince, MembersSince)                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        template <typename ArchiveT>                                                                                                                                                                                                                                                                                                                                       \
+        static constexpr size_t const SerializedSizeUpperBound = BoostHelpers::Serialization::Details::AddSerializedSizeUpperBounds(                                                                                                                                                                                                                                       \
+            {                                                                                                                                                                                                                                                                                                                                                              \
+                BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_BasesSerializedSizeUpperBound, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                   \
+                BOOST_PP_IIF(BOOST_PP_OR(HasCustomLocalDataTypes, IsVersioned), SERIALIZATION_Impl_PODImpl_CustomLocalDataSerializedSizeUpperBound, SERIALIZATION_Impl_PODImpl_DefaultLocalDataSerializedSizeUpperBound)()                                                                                                                                                 \
+            }                                                                                                                                                                                                                                                                                                                                                              \
+        );                                                                                                                                                                                                                                                                                                                                                                 \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        static constexpr bool const IsArchiveStateless =                                                                                                                                                                                                                                                                                                                   \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_BasesIsArchiveStateless, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                             \
+            BOOST_PP_IIF(BOOST_PP_OR(HasCustomLocalDataTypes, IsVersioned), false, SerializeLocalData::IsArchiveStateless);                                                                                                                                                                                                                                                \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        /* SerializeData is a view of the object; bases and nested SERIALIZATION members are written */                                                                                                                                                                                                                                                                    \
+        /* directly from the object being saved rather than copied into intermediate structures. */                                                                                                                                                                                                                                                                        \
+        using SerializeData                 = BoostHelpers::Serialization::Details::SerializeView<Name>;                                                                                                                                                                                                                                                                   \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        template <typename ArchiveT>                                                                                                                                                                                                                                                                                                                                       \
+        static void Save(ArchiveT &ar, Name const &obj) {                                                                                                                                                                                                                                                                                                                  \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Save_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                                          \
+            SerializeLocalData(obj).Execute(ar);                                                                                                                                                                                                                                                                                                                           \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        struct DeserializeData : public BoostHelpers::Serialization::Details::SerializationDataTraits<DeserializeData> {                                                                                                                                                                                                                                                   \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Deserialize_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                                   \
+            DeserializeLocalData            local;                                                                                                                                                                                                                                                                                                                         \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            DeserializeData(void) {                                                                                                                                                                                                                                                                                                                                        \
+            }                                                                                                                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            DeserializeData(DeserializeData && other) :                                                                                                                                                                                                                                                                                                                    \
+                BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Deserialize_Ctor, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                                \
+                local(std::move(other.local))                                                                                                                                                                                                                                                                                                                              \
+            {}                                                                                                                                                                                                                                                                                                                                                             \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            DeserializeData & operator =(DeserializeData && other) {                                                                                                                                                                                                                                                                                                       \
+                UNUSED(other);                                                                                                                                                                                                                                                                                                                                             \
+                                                                                                                                                                                                                                                                                                                                                                           \
+                BOOST_PP_IIF(HasBases, SERIALIZEATION_Impl_PODImpl_Deserialize_MoveAssign, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                         \
+                local = std::move(other.local);                                                                                                                                                                                                                                                                                                                            \
+                                                                                                                                                                                                                                                                                                                                                                           \
+                return *this;                                                                                                                                                                                                                                                                                                                                              \
+            }                                                                                                                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            DeserializeData(DeserializeData const &) = delete;                                                                                                                                                                                                                                                                                                             \
+            DeserializeData & operator =(DeserializeData const &) = delete;                                                                                                                                                                                                                                                                                                \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            template <typename ArchiveT>                                                                                                                                                                                                                                                                                                                                   \
+            void Execute(ArchiveT &ar) {                                                                                                                                                                                                                                                                                                                                   \
+                BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_Deserialize_Execute, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                             \
+                local.Execute(ar);                                                                                                                                                                                                                                                                                                                                         \
+            }                                                                                                                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        private:                                                                                                                                                                                                                                                                                                                                                           \
+            friend class boost::serialization::access;                                                                                                                                                                                                                                                                                                                     \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            BOOST_SERIALIZATION_SPLIT_MEMBER();                                                                                                                                                                                                                                                                                                                            \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            template <typename ArchiveT>                                                                                                                                                                                                                                                                                                                                   \
+            void load(ArchiveT &ar, unsigned int const) {                                                                                                                                                                                                                                                                                                                  \
+                Execute(ar);                                                                                                                                                                                                                                                                                                                                               \
+            }                                                                                                                                                                                                                                                                                                                                                              \
+        };                                                                                                                                                                                                                                                                                                                                                                 \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        /* Moves the storage of the object's members into the data before it is read (see SERIALIZATION_DESERIALIZE_INTO) */                                                                                                                                                                                                                                               \
+        static void LendStorage(Name &obj, DeserializeData &data) {                                                                                                                                                                                                                                                                                                        \
+            UNUSED(obj);                                                                                                                                                                                                                                                                                                                                                   \
+            UNUSED(data);                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_LendStorage_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                                   \
+            BOOST_PP_IIF(BOOST_PP_AND(HasMembers, BOOST_PP_NOT(HasCustomLocalDataTypes)), SERIALIZATION_Impl_PODImpl_LendStorage_Members, BOOST_VMD_EMPTY)(Members)                                                                                                                                                                                                        \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        /* Writes and reads the members that differ from a baseline object (see SERIALIZATION_DELTA); these are */                                                                                                                                                                                                                                                         \
+        /* templates so that the members' equality operators are only required when deltas are used. */                                                                                                                                                                                                                                                                    \
+        static constexpr bool const SupportsDelta = BOOST_PP_IIF(HasCustomLocalDataTypes, false, true);                                                                                                                                                                                                                                                                    \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        template <typename ObjT>                                                                                                                                                                                                                                                                                                                                           \
+        static std::uint64_t GetDeltaMask(ObjT const &obj, ObjT const &baseline) {                                                                                                                                                                                                                                                                                         \
+            UNUSED(obj);                                                                                                                                                                                                                                                                                                                                                   \
+            UNUSED(baseline);                                                                                                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            std::uint64_t                   result(0);                                                                                                                                                                                                                                                                                                                     \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(BOOST_PP_AND(HasMembers, BOOST_PP_NOT(HasCustomLocalDataTypes)), SERIALIZATION_Impl_PODImpl_GetDeltaMask_Members, BOOST_VMD_EMPTY)(Members)                                                                                                                                                                                                       \
+            return result;                                                                                                                                                                                                                                                                                                                                                 \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        template <typename ObjT>                                                                                                                                                                                                                                                                                                                                           \
+        static bool HasDeltaChanges(ObjT const &obj, ObjT const &baseline) {                                                                                                                                                                                                                                                                                               \
+            return BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_HasDeltaChanges_Bases, BOOST_VMD_EMPTY)(Bases) GetDeltaMask(obj, baseline) != 0;                                                                                                                                                                                                                      \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        template <typename ArchiveT>                                                                                                                                                                                                                                                                                                                                       \
+        static void SaveDelta(ArchiveT &ar, Name const &obj, Name const &baseline) {                                                                                                                                                                                                                                                                                       \
+            static_assert(BoostHelpers::Serialization::Details::DependentValue<ArchiveT, SupportsDelta>, "Deltas cannot be serialized for classes that use SERIALIZATION_DATA_CUSTOM_TYPES");                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            UNUSED(ar);                                                                                                                                                                                                                                                                                                                                                    \
+            UNUSED(obj);                                                                                                                                                                                                                                                                                                                                                   \
+            UNUSED(baseline);                                                                                                                                                                                                                                                                                                                                              \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_SaveDelta_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                                     \
+            BOOST_PP_IIF(BOOST_PP_AND(HasMembers, BOOST_PP_NOT(HasCustomLocalDataTypes)), SERIALIZATION_Impl_PODImpl_SaveDelta_Members, BOOST_VMD_EMPTY)(Members)                                                                                                                                                                                                          \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        template <typename ArchiveT>                                                                                                                                                                                                                                                                                                                                       \
+        static void LoadDelta(ArchiveT &ar, DeserializeData &data, std::vector<std::uint64_t> &masks) {                                                                                                                                                                                                                                                                    \
+            static_assert(BoostHelpers::Serialization::Details::DependentValue<ArchiveT, SupportsDelta>, "Deltas cannot be deserialized for classes that use SERIALIZATION_DATA_CUSTOM_TYPES");                                                                                                                                                                            \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            UNUSED(ar);                                                                                                                                                                                                                                                                                                                                                    \
+            UNUSED(data);                                                                                                                                                                                                                                                                                                                                                  \
+            UNUSED(masks);                                                                                                                                                                                                                                                                                                                                                 \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_LoadDelta_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                                     \
+            BOOST_PP_IIF(BOOST_PP_AND(HasMembers, BOOST_PP_NOT(HasCustomLocalDataTypes)), SERIALIZATION_Impl_PODImpl_LoadDelta_Members, BOOST_VMD_EMPTY)(Name, Members)                                                                                                                                                                                                    \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        /* Moves the storage of the members that weren't read by LoadDelta into the data; masks are the bitmaps read by LoadDelta. */                                                                                                                                                                                                                                      \
+        static void LendDeltaStorage(Name &obj, DeserializeData &data, std::vector<std::uint64_t> const &masks, size_t &maskIndex) {                                                                                                                                                                                                                                       \
+            UNUSED(obj);                                                                                                                                                                                                                                                                                                                                                   \
+            UNUSED(data);                                                                                                                                                                                                                                                                                                                                                  \
+            UNUSED(masks);                                                                                                                                                                                                                                                                                                                                                 \
+            UNUSED(maskIndex);                                                                                                                                                                                                                                                                                                                                             \
+                                                                                                                                                                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Bases, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                              \
+            BOOST_PP_IIF(BOOST_PP_AND(HasMembers, BOOST_PP_NOT(HasCustomLocalDataTypes)), SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Members, BOOST_VMD_EMPTY)(Members)                                                                                                                                                                                                   \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        static void RegisterBaseClasses(void) {                                                                                                                                                                                                                                                                                                                            \
+            BOOST_PP_IIF(HasBases, SERIALIZATION_Impl_PODImpl_RegisterBaseClasses, BOOST_VMD_EMPTY)(Bases)                                                                                                                                                                                                                                                                 \
+        }                                                                                                                                                                                                                                                                                                                                                                  \
+                                                                                                                                                                                                                                                                                                                                                                           \
+        BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), SERIALIZATION_Impl_PODImpl_VirtualDestructor, BOOST_VMD_EMPTY)()                                                                                                                                                                                                                                          \
+        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), IsPolymorphic), SERIALIZATION_Impl_PODImpl_ConstructPtr, BOOST_VMD_EMPTY)(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)                                                                                                                                                                            \
+        BOOST_PP_IIF(BOOST_PP_AND(BOOST_PP_NOT(IsDataOnly), BOOST_PP_AND(IsPolymorphic, BOOST_PP_NOT(IsAbstract))), SERIALIZATION_Impl_PODImpl_PolymorphicData, BOOST_VMD_EMPTY)(Name, PolymorphicBaseName)                                                                                                                                                                \
+    };
+
+#define SERIALIZATION_Impl_PODImpl_PolymorphicTypeIds(IsPolymorphicTypeIds)          static constexpr bool const UsesPolymorphicTypeIds = BOOST_PP_IIF(IsPolymorphicTypeIds, true, false);
 
-#define SERIALIZATION_Impl_PODImpl_SerializePolymorphicMembers(PolymorphicBaseName)     using PolymorphicBaseClass = PolymorphicBaseName; PolymorphicBaseClass const * const pPolymorphicBaseClass = nullptr;
+#define SERIALIZATION_Impl_PODImpl_RootBaseClass(Bases)                                 : public boost::serialization::basic_traits
+
+#define SERIALIZATION_Impl_PODImpl_BaseClasses(Bases)                                   : BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_BaseClasses_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_BaseClasses_Macro(r, _, Base)                        public Base::SerializationPOD
 
-#define SERIALIZATION_Impl_PODImpl_Serialize_Bases(Bases)                               BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_Serialize_Bases_Macro, _, Bases)
-#define SERIALIZATION_Impl_PODImpl_Serialize_Bases_Macro(r, _, Index, Base)             typename Base::SerializationPOD::SerializeData const BOOST_PP_CAT(base, Index);
+#define SERIALIZATION_Impl_PODImpl_BasesSerializedSizeUpperBound(Bases)                 BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_BasesSerializedSizeUpperBound_Macro, _, Bases) ,
+#define SERIALIZATION_Impl_PODImpl_BasesSerializedSizeUpperBound_Macro(r, _, Base)      Base::SerializationPOD::SerializedSizeUpperBound<ArchiveT>
 
-#define SERIALIZATION_Impl_PODImpl_Serialize_Ctor(Bases)                                BOOST_PP_TUPLE_FOR_EACH_ENUM_I(SERIALIZATION_Impl_PODImpl_Serialize_Ctor_Macro, _, Bases) ,
-#define SERIALIZATION_Impl_PODImpl_Serialize_Ctor_Macro(r, _, Index, Base)              BOOST_PP_CAT(base, Index)(obj)
+/* Versioned objects write their version the first time that they are encountered in an archive, */
+/* so the size of an object serialized in isolation may include it. */
+#define SERIALIZATION_Impl_PODImpl_CustomLocalDataSerializedSizeUpperBound()            BoostHelpers::Serialization::Details::UnboundedSerializedSize
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataSerializedSizeUpperBound()           SerializeLocalData::SerializedSizeUpperBound<ArchiveT>
 
-#define SERIALIZATION_Impl_PODImpl_Serialize_MoveCtor(Bases)                            BOOST_PP_TUPLE_FOR_EACH_ENUM_I(SERIALIZATION_Impl_PODImpl_Serialize_MoveCtor_Macro, _, Bases) ,
-#define SERIALIZATION_Impl_PODImpl_Serialize_MoveCtor_Macro(r, _, Index, Base)          BOOST_PP_CAT(base, Index)(std::move(make_mutable(other. BOOST_PP_CAT(base, Index))))
+#define SERIALIZATION_Impl_PODImpl_BasesIsArchiveStateless(Bases)                       BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_BasesIsArchiveStateless_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_BasesIsArchiveStateless_Macro(r, _, Base)            Base::SerializationPOD::IsArchiveStateless &&
 
-#define SERIALIZATION_Impl_PODImpl_Serialize_MoveAssign(Bases)                          BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_Serialize_MoveAssign_Macro, _, Bases)
-#define SERIALIZATION_Impl_PODImpl_Serialize_MoveAssign_Macro(r, _, Index, Base)        make_mutable(BOOST_PP_CAT(base, Index)) = std::move(make_mutable(other. BOOST_PP_CAT(base, Index)));
+#define SERIALIZATION_Impl_PODImpl_Save_Bases(Bases)                                   BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_Save_Bases_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_Save_Bases_Macro(r, _, Base)                         { constexpr char const * const baseName(BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(Base))); BoostHelpers::Serialization::Details::SaveView<Base>(ar, baseName, obj); }
 
 #define SERIALIZATION_Impl_PODImpl_Deserialize_Bases(Bases)                             BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_Deserialize_Bases_Macro, _, Bases)
 #define SERIALIZATION_Impl_PODImpl_Deserialize_Bases_Macro(r, _, Index, Base)           typename Base::SerializationPOD::DeserializeData BOOST_PP_CAT(base, Index);
@@ -754,111 +1260,234 @@ namespace Serialization {
 #define SERIALIZEATION_Impl_PODImpl_Deserialize_MoveAssign(Bases)                       BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZEATION_Impl_PODImpl_Deserialize_MoveAssign_Macro, _, Bases)
 #define SERIALIZEATION_Impl_PODImpl_Deserialize_MoveAssign_Macro(r, _, Index, Base)     BOOST_PP_CAT(base, Index) = std::move(other. BOOST_PP_CAT(base, Index));
 
-#define SERIALIZATION_Impl_PODImpl_DelayInitCtor(Bases)                                 BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_DelayInitCtor_Macro, _, Bases) ,
-#define SERIALIZATION_Impl_PODImpl_DelayInitCtor_Macro(r, _, Base)                      Base::SerializationPOD(BoostHelpers::Serialization::Details::DelayInitTag())
-
-#define SERIALIZATION_Impl_PODImpl_Construct(Name)                                      Name Construct(void) { return MoveDeserializeData(); }
-
-#define SERIALIZATION_Impl_PODImpl_ConstructPtr(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)                                                               \
-    BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_PP_IDENTITY(virtual), BOOST_VMD_EMPTY)()                                                             \
-        std::unique_ptr<PolymorphicBaseName> ConstructPtr(void)                                                                                                         \
-            BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_VMD_EMPTY, BOOST_PP_IDENTITY(override))()                                                    \
-                BOOST_PP_IIF(IsAbstract, SERIALIZATION_Impl_PODImpl_ConstructPtr_Abstract, SERIALIZATION_Impl_PODImpl_ConstructPtr_Concrete)(Name, PolymorphicBaseName) \
-                                                                                                                                                                        \
-    void SetOriginalBaseClass(PolymorphicBaseName const &obj) const {                                                                                                   \
-        if(_pSerializeData == nullptr)                                                                                                                                  \
-            throw std::logic_error("SetOriginalBaseClass can only be invoked on serializing PODs");                                                                     \
-                                                                                                                                                                        \
-        if(_pSerializeData->pPolymorphicBaseClass != nullptr)                                                                                                           \
-            throw std::logic_error("The original base class has already been set");                                                                                     \
-                                                                                                                                                                        \
-        const_cast<PolymorphicBaseName const *&>(_pSerializeData->pPolymorphicBaseClass) = &obj;                                                                        \
-    }                                                                                                                                                                   \
-                                                                                                                                                                        \
-    PolymorphicBaseName const & GetOriginalBaseClass(void) const {                                                                                                      \
-        if(_pSerializeData == nullptr)                                                                                                                                  \
-            throw std::logic_error("SerializeData is not available");                                                                                                   \
-                                                                                                                                                                        \
-        if(_pSerializeData->pPolymorphicBaseClass == nullptr)                                                                                                           \
-            throw std::logic_error("The original base class has not been set");                                                                                         \
-                                                                                                                                                                        \
-        return *_pSerializeData->pPolymorphicBaseClass;                                                                                                                 \
-    }
+#define SERIALIZATION_Impl_PODImpl_Deserialize_Execute(Bases)                           BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_Deserialize_Execute_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_Deserialize_Execute_Macro(r, _, Index, Base)         { constexpr char const * const baseName(BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(Base))); BoostHelpers::Serialization::Details::LoadNamed(ar, baseName, BOOST_PP_CAT(base, Index)); }
+
+#define SERIALIZATION_Impl_PODImpl_LendStorage_Bases(Bases)                             BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_LendStorage_Bases_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_LendStorage_Bases_Macro(r, _, Index, Base)           Base::SerializationPOD::LendStorage(obj, data. BOOST_PP_CAT(base, Index));
+
+#define SERIALIZATION_Impl_PODImpl_LendStorage_Members(Members)                         BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_LendStorage_Members_Macro, _, Members)
+#define SERIALIZATION_Impl_PODImpl_LendStorage_Members_Macro(r, _, Member)              BoostHelpers::Serialization::Details::LendMemberStorage(obj.Member, data.local.Member);
+
+#define SERIALIZATION_Impl_PODImpl_GetDeltaMask_Members(Members)                        BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_GetDeltaMask_Members_Macro, _, Members)
+#define SERIALIZATION_Impl_PODImpl_GetDeltaMask_Members_Macro(r, _, Index, Member)      if(BoostHelpers::Serialization::Details::IsDeltaEqual(obj.Member, baseline.Member) == false) result |= std::uint64_t(1) << Index;
+
+#define SERIALIZATION_Impl_PODImpl_HasDeltaChanges_Bases(Bases)                         BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_HasDeltaChanges_Bases_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_HasDeltaChanges_Bases_Macro(r, _, Base)              Base::SerializationPOD::template HasDeltaChanges<Base>(obj, baseline) ||
+
+#define SERIALIZATION_Impl_PODImpl_SaveDelta_Bases(Bases)                               BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_SaveDelta_Bases_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_SaveDelta_Bases_Macro(r, _, Base)                    Base::SerializationPOD::SaveDelta(ar, obj, baseline);
+
+#define SERIALIZATION_Impl_PODImpl_SaveDelta_Members(Members)                           static_assert(BOOST_PP_TUPLE_SIZE(Members) <= 64, "Deltas can only be serialized for classes with at most 64 members"); std::uint64_t const changed(GetDeltaMask(obj, baseline)); BoostHelpers::Serialization::Details::SaveDeltaMask<BOOST_PP_TUPLE_SIZE(Members)>(ar, changed); BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_SaveDelta_Members_Macro, _, Members)
+#define SERIALIZATION_Impl_PODImpl_SaveDelta_Members_Macro(r, _, Index, Member)         if(changed & (std::uint64_t(1) << Index)) BoostHelpers::Serialization::Details::SaveDeltaMember(ar, BOOST_PP_STRINGIZE(Member), obj.Member, baseline.Member);
+
+#define SERIALIZATION_Impl_PODImpl_LoadDelta_Bases(Bases)                               BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_LoadDelta_Bases_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_LoadDelta_Bases_Macro(r, _, Index, Base)             Base::SerializationPOD::LoadDelta(ar, data. BOOST_PP_CAT(base, Index), masks);
+
+#define SERIALIZATION_Impl_PODImpl_LoadDelta_Members(Name, Members)                     std::uint64_t const changed(BoostHelpers::Serialization::Details::LoadDeltaMask<BOOST_PP_TUPLE_SIZE(Members)>(ar)); masks.push_back(changed); BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_LoadDelta_Members_Macro, Name, Members)
+#define SERIALIZATION_Impl_PODImpl_LoadDelta_Members_Macro(r, Name, Index, Member)      static_assert(BoostHelpers::Serialization::Details::DependentValue<ArchiveT, BoostHelpers::Serialization::Details::IsDeltaMember<decltype(Name::Member)>()>, "Deltas cannot be deserialized for members that are raw pointers or use SERIALIZATION_DATA_CUSTOM_TYPES ('" BOOST_PP_STRINGIZE(Member) "')"); if(changed & (std::uint64_t(1) << Index)) BoostHelpers::Serialization::Details::LoadDeltaMember<decltype(Name::Member)>(ar, BOOST_PP_STRINGIZE(Member), data.local.Member, masks);
+
+#define SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Bases(Bases)                        BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Bases_Macro, _, Bases)
+#define SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Bases_Macro(r, _, Index, Base)      Base::SerializationPOD::LendDeltaStorage(obj, data. BOOST_PP_CAT(base, Index), masks, maskIndex);
+
+#define SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Members(Members)                    std::uint64_t const changed(masks[maskIndex++]); BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Members_Macro, _, Members)
+#define SERIALIZATION_Impl_PODImpl_LendDeltaStorage_Members_Macro(r, _, Index, Member)  if(changed & (std::uint64_t(1) << Index)) BoostHelpers::Serialization::Details::LendDeltaMemberStorage(obj.Member, data.local.Member, masks, maskIndex); else BoostHelpers::Serialization::Details::LendMemberStorage(obj.Member, data.local.Member);
+
+#define SERIALIZATION_Impl_PODImpl_RegisterBaseClasses(Bases)                           BoostHelpers::Serialization::Details::RegisterOnce<SerializationPOD>([](void) { BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_RegisterBaseClasses_Macro, _, Bases) });
+#define SERIALIZATION_Impl_PODImpl_RegisterBaseClasses_Macro(r, _, Base)                BoostHelpers::Serialization::Details::RegisterSerializationPODBaseClass<SerializationPOD, Base::SerializationPOD>();
+
+#define SERIALIZATION_Impl_PODImpl_VirtualDestructor()                                  virtual ~SerializationPOD(void) = default;
+
+#define SERIALIZATION_Impl_PODImpl_ConstructPtr(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)                                                                                                                       \
+    BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_PP_IDENTITY(virtual), BOOST_VMD_EMPTY)()                                                                                                                     \
+        std::unique_ptr<PolymorphicBaseName> ConstructPtr(void)                                                                                                                                                                 \
+            BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_VMD_EMPTY, BOOST_PP_IDENTITY(override))()                                                                                                            \
+                BOOST_PP_IIF(IsAbstract, SERIALIZATION_Impl_PODImpl_ConstructPtr_Abstract, SERIALIZATION_Impl_PODImpl_ConstructPtr_Concrete)(Name, PolymorphicBaseName)                                                         \
+                                                                                                                                                                                                                                \
+    SERIALIZATION_Impl_PODImpl_ConstructArenaPtr(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)
 
 #define SERIALIZATION_Impl_PODImpl_ConstructPtr_Abstract(Name, PolymorphicBaseName)     = 0;
-#define SERIALIZATION_Impl_PODImpl_ConstructPtr_Concrete(Name, PolymorphicBaseName)     { return std::make_unique<Name>(MoveDeserializeData()); }
+#define SERIALIZATION_Impl_PODImpl_ConstructPtr_Concrete(Name, PolymorphicBaseName)                                                                                                                                             \
+    {                                                                                                                                                                                                                           \
+        if(_deserializeData.has_value() == false)                                                                                                                                                                               \
+            throw std::logic_error("DeserializeData has already been moved or never existed");                                                                                                                                  \
+                                                                                                                                                                                                                                \
+        std::unique_ptr<PolymorphicBaseName>            result(std::make_unique<Name>(std::move(*_deserializeData)));                                                                                                           \
+                                                                                                                                                                                                                                \
+        _deserializeData.reset();                                                                                                                                                                                               \
+        return result;                                                                                                                                                                                                          \
+    }
+
+#if (defined __cpp_lib_memory_resource)
+#   define SERIALIZATION_Impl_PODImpl_ConstructArenaPtr(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)                                                                                                               \
+    BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), SERIALIZATION_Impl_PODImpl_ConstructArenaPtr_Allocation, BOOST_VMD_EMPTY)()                                                                                        \
+                                                                                                                                                                                                                                \
+    BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_PP_IDENTITY(virtual), BOOST_VMD_EMPTY)()                                                                                                                     \
+        BoostHelpers::Serialization::ArenaUniquePtr<PolymorphicBaseName> ConstructPtr(std::pmr::memory_resource &resource)                                                                                                      \
+            BOOST_PP_IIF(BOOST_PP_OR(IsAbstract, IsPolymorphicBase), BOOST_VMD_EMPTY, BOOST_PP_IDENTITY(override))()                                                                                                            \
+                BOOST_PP_IIF(IsAbstract, SERIALIZATION_Impl_PODImpl_ConstructPtr_Abstract, SERIALIZATION_Impl_PODImpl_ConstructArenaPtr_Concrete)(Name, PolymorphicBaseName)
+
+#   define SERIALIZATION_Impl_PODImpl_ConstructArenaPtr_Allocation()                                                                                                                                                            \
+    /* Polymorphic SerializationPOD objects are created by boost when they are deserialized; allocate them */                                                                                                                   \
+    /* from the memory resource provided to DeserializePtr (if any). */                                                                                                                                                         \
+    static void * operator new(size_t cBytes) {                                                                                                                                                                                 \
+        return BoostHelpers::Serialization::Details::AllocateSerializationPOD(cBytes);                                                                                                                                          \
+    }                                                                                                                                                                                                                           \
+                                                                                                                                                                                                                                \
+    static void operator delete(void *pMemory) noexcept {                                                                                                                                                                       \
+        BoostHelpers::Serialization::Details::DeallocateSerializationPOD(pMemory);                                                                                                                                              \
+    }
 
-#define SERIALIZATION_Impl_PODImpl_DelayedCtor(Bases)                       : BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_DelayedCtor_Macro, _, Bases)
-#define SERIALIZATION_Impl_PODImpl_DelayedCtor_Macro(r, _, Base)            Base::SerializationPOD(tag)
+#   define SERIALIZATION_Impl_PODImpl_ConstructArenaPtr_Concrete(Name, PolymorphicBaseName)                                                                                                                                     \
+    {                                                                                                                                                                                                                           \
+        if(_deserializeData.has_value() == false)                                                                                                                                                                               \
+            throw std::logic_error("DeserializeData has already been moved or never existed");                                                                                                                                  \
+                                                                                                                                                                                                                                \
+        BoostHelpers::Serialization::ArenaUniquePtr<PolymorphicBaseName>                result(BoostHelpers::Serialization::Details::ConstructArenaPtr<Name, PolymorphicBaseName>(resource, std::move(*_deserializeData)));     \
+                                                                                                                                                                                                                                \
+        _deserializeData.reset();                                                                                                                                                                                               \
+        return result;                                                                                                                                                                                                          \
+    }
 
-#define SERIALIZATION_Impl_PODImpl_Init(Bases)                              BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_Init_Macro, _, Bases)
-#define SERIALIZATION_Impl_PODImpl_Init_Macro(r, _, Index, Base)            Base::SerializationPOD::Init(data. BOOST_PP_CAT(base, Index));
+#   define SERIALIZATION_Impl_PODImpl_OnConstructed()                                   BoostHelpers::Serialization::Details::OnSerializationPODConstructed(*this);
+#else
+#   define SERIALIZATION_Impl_PODImpl_ConstructArenaPtr(Name, IsAbstract, IsPolymorphicBase, PolymorphicBaseName)
+#   define SERIALIZATION_Impl_PODImpl_OnConstructed()
+#endif
 
-#define SERIALIZATION_Impl_PODImpl_Serialize(Bases)                         BOOST_PP_TUPLE_FOR_EACH_I(SERIALIZATION_Impl_PODImpl_Serialize_Macro, _, Bases)
-#define SERIALIZATION_Impl_PODImpl_Serialize_Macro(r, _, Index, Base)       ar & boost::serialization::make_nvp(BoostHelpers::Serialization::Details::ScrubSerializationName(BOOST_PP_STRINGIZE(Base)), boost::serialization::base_object<Base::SerializationPOD>(*this));
+#define SERIALIZATION_Impl_PODImpl_PolymorphicData(Name, PolymorphicBaseName)                                                                                                                                                   \
+    SerializationPOD(Name const &obj) :                                                                                                                                                                                         \
+        _pObj(&obj)                                                                                                                                                                                                             \
+    {}                                                                                                                                                                                                                          \
+                                                                                                                                                                                                                                \
+    SerializationPOD(void) noexcept {                                                                                                                                                                                           \
+        SERIALIZATION_Impl_PODImpl_OnConstructed()                                                                                                                                                                              \
+    }                                                                                                                                                                                                                           \
+                                                                                                                                                                                                                                \
+    SerializationPOD(SerializationPOD const &) = delete;                                                                                                                                                                        \
+    SerializationPOD & operator =(SerializationPOD const &) = delete;                                                                                                                                                           \
+                                                                                                                                                                                                                                \
+    PolymorphicBaseName const & GetOriginalBaseClass(void) const {                                                                                                                                                              \
+        if(_pObj == nullptr)                                                                                                                                                                                                    \
+            throw std::logic_error("SerializeData is not available");                                                                                                                                                           \
+                                                                                                                                                                                                                                \
+        return *_pObj;                                                                                                                                                                                                          \
+    }                                                                                                                                                                                                                           \
+                                                                                                                                                                                                                                \
+private:                                                                                                                                                                                                                        \
+    friend class boost::serialization::access;                                                                                                                                                                                  \
+                                                                                                                                                                                                                                \
+    /* The object being serialized (when saving) or the data used to construct the new object (when loading) */                                                                                                                 \
+    Name const * const                                  _pObj = nullptr;                                                                                                                                                        \
+    std::optional<DeserializeData>                      _deserializeData;                                                                                                                                                       \
+                                                                                                                                                                                                                                \
+    BOOST_SERIALIZATION_SPLIT_MEMBER();                                                                                                                                                                                         \
+                                                                                                                                                                                                                                \
+    template <typename ArchiveT>                                                                                                                                                                                                \
+    void save(ArchiveT &ar, unsigned int const) const {                                                                                                                                                                         \
+        if(_pObj == nullptr)                                                                                                                                                                                                    \
+            throw std::logic_error("SerializeData is not available");                                                                                                                                                           \
+                                                                                                                                                                                                                                \
+        RegisterBaseClasses();                                                                                                                                                                                                  \
+        SerializeData(*_pObj).Execute(ar);                                                                                                                                                                                      \
+    }                                                                                                                                                                                                                           \
+                                                                                                                                                                                                                                \
+    template <typename ArchiveT>                                                                                                                                                                                                \
+    void load(ArchiveT &ar, unsigned int const) {                                                                                                                                                                               \
+        RegisterBaseClasses();                                                                                                                                                                                                  \
+        _deserializeData.emplace().Execute(ar);                                                                                                                                                                                 \
+    }
 
 // ----------------------------------------------------------------------
-#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes(Name, HasMembers, Members, HasDeserializeDataCustomCtor)                                                                                           \
-    struct SerializeLocalData {                                                                                                                                                                             \
-        BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMembers, BOOST_VMD_EMPTY)(Name, Members)                                                                         \
-                                                                                                                                                                                                            \
-        SerializeLocalData(Name const &obj)                                                                                                                                                                 \
-            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeCtor, BOOST_VMD_EMPTY)(Members)                                                                              \
-        { UNUSED(obj); }                                                                                                                                                                                    \
-                                                                                                                                                                                                            \
-        SerializeLocalData(SerializeLocalData && other)                                                                                                                                                     \
-            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMoveCtor, BOOST_VMD_EMPTY)(Members)                                                                          \
-        { UNUSED(other); }                                                                                                                                                                                  \
-                                                                                                                                                                                                            \
-        SerializeLocalData & operator =(SerializeLocalData && other) {                                                                                                                                      \
-            UNUSED(other);                                                                                                                                                                                  \
-                                                                                                                                                                                                            \
-            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMoveAssign, BOOST_VMD_EMPTY)(Members)                                                                        \
-                                                                                                                                                                                                            \
-            return *this;                                                                                                                                                                                   \
-        }                                                                                                                                                                                                   \
-                                                                                                                                                                                                            \
-        SerializeLocalData(SerializeLocalData const &) = delete;                                                                                                                                            \
-        SerializeLocalData & operator =(SerializeLocalData const &) = delete;                                                                                                                               \
-                                                                                                                                                                                                            \
-        template <typename ArchiveT>                                                                                                                                                                        \
-        void Execute(ArchiveT &ar) const {                                                                                                                                                                  \
-            UNUSED(ar);                                                                                                                                                                                     \
-            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute, BOOST_VMD_EMPTY)(Members)                                                                           \
-        }                                                                                                                                                                                                   \
-    };                                                                                                                                                                                                      \
-                                                                                                                                                                                                            \
-    struct DeserializeLocalData {                                                                                                                                                                           \
-        BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMembers, BOOST_VMD_EMPTY)(Name, Members)                                                                       \
-                                                                                                                                                                                                            \
-        DeserializeLocalData(void)                                                                                                                                                                          \
-            BOOST_PP_IIF(HasDeserializeDataCustomCtor, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeCustomCtor, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeDefaultCtor)()   \
-                                                                                                                                                                                                            \
-        DeserializeLocalData(DeserializeLocalData && other)                                                                                                                                                 \
-            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeCtor, BOOST_VMD_EMPTY)(Members)                                                                            \
-        { UNUSED(other); }                                                                                                                                                                                  \
-                                                                                                                                                                                                            \
-        DeserializeLocalData & operator =(DeserializeLocalData && other) {                                                                                                                                  \
-            UNUSED(other);                                                                                                                                                                                  \
-                                                                                                                                                                                                            \
-            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMoveAssign, BOOST_VMD_EMPTY)(Members)                                                                      \
-                                                                                                                                                                                                            \
-            return *this;                                                                                                                                                                                   \
-        }                                                                                                                                                                                                   \
-                                                                                                                                                                                                            \
-        DeserializeLocalData(DeserializeLocalData const &) = delete;                                                                                                                                        \
-        DeserializeLocalData & operator =(DeserializeLocalData const &) = delete;                                                                                                                           \
-                                                                                                                                                                                                            \
-        template <typename ArchiveT>                                                                                                                                                                        \
-        void Execute(ArchiveT &ar) {                                                                                                                                                                        \
-            UNUSED(ar);                                                                                                                                                                                     \
-            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecute, BOOST_VMD_EMPTY)(Members)                                                                         \
-        }                                                                                                                                                                                                   \
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes(Name, HasMembers, Members, HasDeserializeDataCustomCtor, IsBitwise, IsVersioned, Version, HasMembersSince, MembersSince)                                                                                                 \
+    struct SerializeLocalData {                                                                                                                                                                                                                                                   \
+        BOOST_PP_IIF(BOOST_PP_AND(HasMembers, IsBitwise), SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_BitwiseChecks, BOOST_VMD_EMPTY)(Name, Members)                                                                                                                         \
+        BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMembers, BOOST_VMD_EMPTY)(Name, Members)                                                                                                                                               \
+                                                                                                                                                                                                                                                                                  \
+        template <typename ArchiveT>                                                                                                                                                                                                                                              \
+        static constexpr size_t const SerializedSizeUpperBound = BoostHelpers::Serialization::Details::GetLocalDataSerializedSizeUpperBound<                                                                                                                                      \
+            ArchiveT,                                                                                                                                                                                                                                                             \
+            BOOST_PP_IIF(IsBitwise, true, false)                                                                                                                                                                                                                                  \
+            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_MemberTypes, BOOST_VMD_EMPTY)(Name, Members)                                                                                                                                                \
+        >();                                                                                                                                                                                                                                                                      \
+                                                                                                                                                                                                                                                                                  \
+        static constexpr bool const IsArchiveStateless = BoostHelpers::Serialization::Details::AreArchiveStatelessMembers<                                                                                                                                                        \
+            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_MemberTypesEnum, BOOST_VMD_EMPTY)(Name, Members)                                                                                                                                            \
+        >();                                                                                                                                                                                                                                                                      \
+                                                                                                                                                                                                                                                                                  \
+        SerializeLocalData(Name const &obj)                                                                                                                                                                                                                                       \
+            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeCtor, BOOST_VMD_EMPTY)(Members)                                                                                                                                                    \
+        { UNUSED(obj); }                                                                                                                                                                                                                                                          \
+                                                                                                                                                                                                                                                                                  \
+        SerializeLocalData(SerializeLocalData && other)                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMoveCtor, BOOST_VMD_EMPTY)(Members)                                                                                                                                                \
+        { UNUSED(other); }                                                                                                                                                                                                                                                        \
+                                                                                                                                                                                                                                                                                  \
+        SerializeLocalData & operator =(SerializeLocalData && other) {                                                                                                                                                                                                            \
+            UNUSED(other);                                                                                                                                                                                                                                                        \
+                                                                                                                                                                                                                                                                                  \
+            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMoveAssign, BOOST_VMD_EMPTY)(Members)                                                                                                                                              \
+                                                                                                                                                                                                                                                                                  \
+            return *this;                                                                                                                                                                                                                                                         \
+        }                                                                                                                                                                                                                                                                         \
+                                                                                                                                                                                                                                                                                  \
+        SerializeLocalData(SerializeLocalData const &) = delete;                                                                                                                                                                                                                  \
+        SerializeLocalData & operator =(SerializeLocalData const &) = delete;                                                                                                                                                                                                     \
+                                                                                                                                                                                                                                                                                  \
+        template <typename ArchiveT>                                                                                                                                                                                                                                              \
+        void Execute(ArchiveT &ar) const {                                                                                                                                                                                                                                        \
+            UNUSED(ar);                                                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(BOOST_PP_AND(HasMembers, BOOST_PP_NOT(IsVersioned)), BOOST_PP_IIF(IsBitwise, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecuteBitwise, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute), BOOST_VMD_EMPTY)(Members)     \
+            BOOST_PP_IIF(IsVersioned, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_VersionedSave, BOOST_VMD_EMPTY)(Version)                                                                                                                                                   \
+        }                                                                                                                                                                                                                                                                         \
+                                                                                                                                                                                                                                                                                  \
+        BOOST_PP_IIF(IsVersioned, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeVersioned, BOOST_VMD_EMPTY)(HasMembers, Members)                                                                                                                                      \
+    };                                                                                                                                                                                                                                                                            \
+                                                                                                                                                                                                                                                                                  \
+    struct DeserializeLocalData {                                                                                                                                                                                                                                                 \
+        BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMembers, BOOST_VMD_EMPTY)(Name, Members)                                                                                                                                             \
+                                                                                                                                                                                                                                                                                  \
+        DeserializeLocalData(void)                                                                                                                                                                                                                                                \
+            BOOST_PP_IIF(HasDeserializeDataCustomCtor, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeCustomCtor, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeDefaultCtor)()                                                                         \
+                                                                                                                                                                                                                                                                                  \
+        DeserializeLocalData(DeserializeLocalData && other)                                                                                                                                                                                                                       \
+            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeCtor, BOOST_VMD_EMPTY)(Members)                                                                                                                                                  \
+        { UNUSED(other); }                                                                                                                                                                                                                                                        \
+                                                                                                                                                                                                                                                                                  \
+        DeserializeLocalData & operator =(DeserializeLocalData && other) {                                                                                                                                                                                                        \
+            UNUSED(other);                                                                                                                                                                                                                                                        \
+                                                                                                                                                                                                                                                                                  \
+            BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMoveAssign, BOOST_VMD_EMPTY)(Members)                                                                                                                                            \
+                                                                                                                                                                                                                                                                                  \
+            return *this;                                                                                                                                                                                                                                                         \
+        }                                                                                                                                                                                                                                                                         \
+                                                                                                                                                                                                                                                                                  \
+        DeserializeLocalData(DeserializeLocalData const &) = delete;                                                                                                                                                                                                              \
+        DeserializeLocalData & operator =(DeserializeLocalData const &) = delete;                                                                                                                                                                                                 \
+                                                                                                                                                                                                                                                                                  \
+        template <typename ArchiveT>                                                                                                                                                                                                                                              \
+        void Execute(ArchiveT &ar) {                                                                                                                                                                                                                                              \
+            UNUSED(ar);                                                                                                                                                                                                                                                           \
+            BOOST_PP_IIF(BOOST_PP_AND(HasMembers, BOOST_PP_NOT(IsVersioned)), BOOST_PP_IIF(IsBitwise, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecuteBitwise, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecute), BOOST_VMD_EMPTY)(Members) \
+            BOOST_PP_IIF(IsVersioned, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_VersionedLoad, BOOST_VMD_EMPTY)(Version)                                                                                                                                                   \
+        }                                                                                                                                                                                                                                                                         \
+                                                                                                                                                                                                                                                                                  \
+        BOOST_PP_IIF(IsVersioned, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeVersioned, BOOST_VMD_EMPTY)(HasMembers, Members, Version, HasMembersSince, MembersSince)                                                                                            \
     };
 
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_BitwiseChecks(Name, Members)                                                                                       \
+    BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_BitwiseChecks_Macro, Name, Members)                                                            \
+    static constexpr size_t const BitwiseMembersSize = 0 BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_BitwiseMembersSize_Macro, Name, Members);
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_BitwiseChecks_Macro(r, Name, Member)  static_assert(BoostHelpers::Serialization::Details::IsBitwiseMember<decltype(Name::Member)>, "SERIALIZATION_DATA_BITWISE requires members that are trivially copyable and not pointers ('" BOOST_PP_STRINGIZE(Member) "')");
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_BitwiseMembersSize_Macro(r, Name, Member)  + sizeof(decltype(Name::Member))
+
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMembers(Name, Members)                BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMembers_Macro, Name, Members)
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMembers_Macro(r, Name, Member)        std::add_const_t<BoostHelpers::Serialization::Details::SerializeDataType<decltype(Name::Member)>> Member;
 
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_MemberTypes(Name, Members)             , SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_MemberTypesEnum(Name, Members)
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_MemberTypesEnum(Name, Members)         BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_MemberTypes_Macro, Name, Members)
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_MemberTypes_Macro(r, Name, Member)     std::remove_cv_t<decltype(Name::Member)>
+
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeCtor(Members)                         : BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeCtor_Macro, _, Members)
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeCtor_Macro(r, _, Member)              Member(obj.Member)
 
@@ -869,7 +1498,14 @@ namespace Serialization {
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeMoveAssign_Macro(r, _, Member)        make_mutable(Member) = std::move(make_mutable(other.Member));
 
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute(Members)                      BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute_Macro, _, Members)
-#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute_Macro(r, _, Member)           ar << boost::serialization::make_nvp(BOOST_PP_STRINGIZE(Member), Member);
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute_Macro(r, _, Member)           BoostHelpers::Serialization::Details::SaveNamed(ar, BOOST_PP_STRINGIZE(Member), Member);
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecuteBitwise(Members)    \
+    if constexpr(BoostHelpers::Serialization::Details::IsBitwiseArchive<ArchiveT>)           \
+        BoostHelpers::Serialization::Details::SaveBitwise(ar, BOOST_PP_TUPLE_ENUM(Members)); \
+    else {                                                                                   \
+        SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute(Members)           \
+    }
 
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMembers(Name, Members)              BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMembers_Macro, Name, Members)
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMembers_Macro(r, Name, Member)      BoostHelpers::Serialization::Details::DeserializeDataType<decltype(Name::Member)> Member;
@@ -884,30 +1520,105 @@ namespace Serialization {
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeMoveAssign_Macro(r, _, Member)      Member = std::move(other.Member);
 
 #define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecute(Members)                    BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecute_Macro, _, Members)
-#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecute_Macro(r, _, Member)         ar >> boost::serialization::make_nvp(BOOST_PP_STRINGIZE(Member), Member);
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecute_Macro(r, _, Member)         BoostHelpers::Serialization::Details::LoadNamed(ar, BOOST_PP_STRINGIZE(Member), Member);
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecuteBitwise(Members)  \
+    if constexpr(BoostHelpers::Serialization::Details::IsBitwiseArchive<ArchiveT>)           \
+        BoostHelpers::Serialization::Details::LoadBitwise(ar, BOOST_PP_TUPLE_ENUM(Members)); \
+    else {                                                                                   \
+        SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeExecute(Members)         \
+    }
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_VersionedSave(Version)                         BoostHelpers::Serialization::Details::SaveVersionedLocalData<Version>(ar, *this);
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_VersionedLoad(Version)                         BoostHelpers::Serialization::Details::LoadVersionedLocalData<Version>(ar, *this);
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeVersioned(HasMembers, Members)                              \
+    /* Invoked by SaveVersionedLocalData after the version has been written */                                                \
+    template <typename ArchiveT>                                                                                              \
+    void ExecuteVersioned(ArchiveT &ar) const {                                                                               \
+        UNUSED(ar);                                                                                                           \
+        BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SerializeExecute, BOOST_VMD_EMPTY)(Members) \
+    }
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_DeserializeVersioned(HasMembers, Members, Version, HasMembersSince, MembersSince)         \
+    BOOST_PP_IIF(HasMembersSince, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceChecks, BOOST_VMD_EMPTY)(Version, MembersSince)            \
+                                                                                                                                                   \
+    /* Returns the version in which the member was added (see SERIALIZATION_MEMBERS_SINCE) */                                                      \
+    static constexpr unsigned int GetMemberSinceVersion(char const *name) {                                                                        \
+        return BoostHelpers::Serialization::Details::GetMemberSinceVersion(                                                                        \
+            name,                                                                                                                                  \
+            { BOOST_PP_IIF(HasMembersSince, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceEntries, BOOST_VMD_EMPTY)(MembersSince) }        \
+        );                                                                                                                                         \
+    }                                                                                                                                              \
+                                                                                                                                                   \
+    /* Invoked by LoadVersionedLocalData with the version read from the archive; members added after */                                            \
+    /* that version aren't read and are assigned their default values instead. */                                                                  \
+    template <typename ArchiveT>                                                                                                                   \
+    void ExecuteVersioned(ArchiveT &ar, unsigned int version) {                                                                                    \
+        UNUSED(ar);                                                                                                                                \
+        UNUSED(version);                                                                                                                           \
+        BOOST_PP_IIF(HasMembers, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_LoadVersionedMembers, BOOST_VMD_EMPTY)(Members)                  \
+        BOOST_PP_IIF(HasMembersSince, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults, BOOST_VMD_EMPTY)(MembersSince)               \
+    }
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_LoadVersionedMembers(Members)                  BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_LoadVersionedMembers_Macro, _, Members)
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_LoadVersionedMembers_Macro(r, _, Member)       if(version >= std::integral_constant<unsigned int, GetMemberSinceVersion(BOOST_PP_STRINGIZE(Member))>::value) BoostHelpers::Serialization::Details::LoadNamed(ar, BOOST_PP_STRINGIZE(Member), Member);
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceChecks(Version, MembersSince)             BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceChecks_Macro, Version, MembersSince)
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceChecks_Macro(r, Version, Entry)           static_assert(BOOST_PP_TUPLE_ELEM(1, Entry) > 0 && BOOST_PP_TUPLE_ELEM(1, Entry) <= Version, "SERIALIZATION_MEMBERS_SINCE versions must be between 1 and the SERIALIZATION_VERSION ('" BOOST_PP_STRINGIZE(BOOST_PP_TUPLE_ELEM(0, Entry)) "')");
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceEntries(MembersSince)                     BOOST_PP_TUPLE_FOR_EACH_ENUM(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceEntries_Macro, _, MembersSince)
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceEntries_Macro(r, _, Entry)                BoostHelpers::Serialization::Details::MemberSinceVersion{ BOOST_PP_STRINGIZE(BOOST_PP_TUPLE_ELEM(0, Entry)), BOOST_PP_TUPLE_ELEM(1, Entry) }
+
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults(MembersSince)                    BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults_Macro, _, MembersSince)
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults_Macro(r, _, Entry)               if(version < BOOST_PP_TUPLE_ELEM(1, Entry)) BOOST_PP_TUPLE_ELEM(0, Entry) = BOOST_PP_IIF(BOOST_PP_EQUAL(BOOST_PP_TUPLE_SIZE(Entry), 3), SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults_Value, SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults_ValueInit)(Entry);
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults_Value(Entry)                     BOOST_PP_TUPLE_ELEM(2, Entry)
+#define SERIALIZATION_Impl_PODImpl_DefaultLocalDataTypes_SinceDefaults_ValueInit(Entry)                 decltype(BOOST_PP_TUPLE_ELEM(0, Entry))()
 
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-#define SERIALIZATION_POLYMORPHIC_DECLARE_Impl(FullyQualifiedObjectName)                                \
-    inline void FullyQualifiedObjectName::SERIALIZATION_POLYMORPHIC_DECLARE_Impl_Func_Name() (void) {}  \
-    BOOST_CLASS_EXPORT_KEY(FullyQualifiedObjectName::SerializationPOD);                                 \
+#define SERIALIZATION_POLYMORPHIC_DECLARE_Impl(FullyQualifiedObjectName)                                                                                                                                                  \
+    static_assert(                                                                                                                                                                                                      \
+        std::is_abstract_v<FullyQualifiedObjectName> || BoostHelpers::Serialization::Details::UsesPolymorphicTypeIds<FullyQualifiedObjectName> == false,                                                                \
+        "Concrete types within a hierarchy declared with SERIALIZATION_POLYMORPHIC_TYPE_IDS must use SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID"                                                                         \
+    );                                                                                                                                                                                                                  \
+    SERIALIZATION_POLYMORPHIC_DECLARE_Impl2(FullyQualifiedObjectName, BoostHelpers::Serialization::Details::NoPolymorphicTypeId)
+
+#define SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID_Impl(FullyQualifiedObjectName, Id)                                                                                                                                    \
+    static_assert(BoostHelpers::Serialization::Details::UsesPolymorphicTypeIds<FullyQualifiedObjectName>, "SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID requires a hierarchy declared with SERIALIZATION_POLYMORPHIC_TYPE_IDS"); \
+    static_assert(std::is_abstract_v<FullyQualifiedObjectName> == false, "SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID cannot be used with abstract types");                                                               \
+    static_assert((Id) >= 0 && (Id) < BoostHelpers::Serialization::Details::MaxPolymorphicTypeId, "Invalid polymorphic type id");                                                                                       \
+    SERIALIZATION_POLYMORPHIC_DECLARE_Impl2(FullyQualifiedObjectName, Id)
+
+#define SERIALIZATION_POLYMORPHIC_DECLARE_Impl2(FullyQualifiedObjectName, Id)                                                                                                                                           \
+    inline void FullyQualifiedObjectName::SERIALIZATION_POLYMORPHIC_DECLARE_Impl_Func_Name() (void) {}                                                                                                                  \
+    inline std::uint32_t FullyQualifiedObjectName::SERIALIZATION_POLYMORPHIC_TYPE_ID_Impl_Func_Name() (void) { return static_cast<std::uint32_t>(Id); }                                                                 \
+    BOOST_CLASS_EXPORT_KEY(FullyQualifiedObjectName::SerializationPOD);                                                                                                                                                 \
     BOOST_CLASS_EXPORT_KEY(FullyQualifiedObjectName);
 
-#define SERIALIZATION_POLYMORPHIC_DEFINE_Impl(FullyQualifiedObjectName)                                 \
-    void FullyQualifiedObjectName::SERIALIZATION_POLYMORPHIC_DEFINE_Impl_Func_Name() (void) {}          \
-    BOOST_CLASS_EXPORT_IMPLEMENT(FullyQualifiedObjectName::SerializationPOD);                           \
+#define SERIALIZATION_POLYMORPHIC_DEFINE_Impl(FullyQualifiedObjectName)                                                                                                                                                 \
+    void FullyQualifiedObjectName::SERIALIZATION_POLYMORPHIC_DEFINE_Impl_Func_Name() (void) {}                                                                                                                          \
+    namespace BoostHelpers { namespace Serialization { namespace Details {                                                                                                                                              \
+        template <> bool const PolymorphicRegistration<FullyQualifiedObjectName>::IsRegistered = RegisterPolymorphicDefinition<FullyQualifiedObjectName>();                                                              \
+    } } }                                                                                                                                                                                                               \
+    BOOST_CLASS_EXPORT_IMPLEMENT(FullyQualifiedObjectName::SerializationPOD);                                                                                                                                           \
     BOOST_CLASS_EXPORT_IMPLEMENT(FullyQualifiedObjectName);
 
 #define SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_Impl(FullyQualifiedObjectName)                     \
     SERIALIZATION_POLYMORPHIC_DECLARE(FullyQualifiedObjectName)                                         \
     SERIALIZATION_POLYMORPHIC_DEFINE(FullyQualifiedObjectName)
 
+#define SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_WITH_ID_Impl(FullyQualifiedObjectName, Id)         \
+    SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID(FullyQualifiedObjectName, Id)                             \
+    SERIALIZATION_POLYMORPHIC_DEFINE(FullyQualifiedObjectName)
+
 #define SERIALIZATION_POLYMORPHIC_DECLARE_Impl_Func_Name()                                              __Ensure_correct_include__See_SERIALIZATION_POLYMORPHIC_DECLARE_for_more_info
 #define SERIALIZATION_POLYMORPHIC_DEFINE_Impl_Func_Name()                                               __Ensure_correct_linkage__See_SERIALIZATION_POLYMORPHIC_DEFINE_for_more_info
+#define SERIALIZATION_POLYMORPHIC_TYPE_ID_Impl_Func_Name()                                              __Polymorphic_type_id__See_SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID_for_more_info
 
 #define SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS_Impl(Name, ...)                                             \
-    void AdditionalVoidCastRegistration(void) const {                                                               \
+    static void AdditionalVoidCastRegistration(void) {                                                              \
         BOOST_PP_TUPLE_FOR_EACH(SERIALIZATION_POLYMORPHIC_ADDITIONAL_VOID_CASTS_Impl_Macro, Name, (__VA_ARGS__))    \
     }
 
@@ -917,8 +1628,223 @@ namespace Serialization {
         static_cast<PolymorphicBaseName const *>(nullptr)                                           \
     );
 
+#define SERIALIZATION_BITWISE_DECLARE_Impl(FullyQualifiedObjectName)                                                                                                \
+    static_assert(FullyQualifiedObjectName::SerializationPOD::IsBitwiseSerializable, "SERIALIZATION_BITWISE_DECLARE requires the SERIALIZATION_DATA_BITWISE flag"); \
+    static_assert(std::is_trivially_copyable_v<FullyQualifiedObjectName>, "SERIALIZATION_BITWISE_DECLARE requires a trivially copyable class");                     \
+    static_assert(std::is_default_constructible_v<FullyQualifiedObjectName>, "SERIALIZATION_BITWISE_DECLARE requires a default constructible class");               \
+    static_assert(                                                                                                                                                  \
+        sizeof(FullyQualifiedObjectName) == FullyQualifiedObjectName::SerializationPOD::SerializeLocalData::BitwiseMembersSize,                                     \
+        "SERIALIZATION_BITWISE_DECLARE requires all data members to be listed in MEMBERS"                                                                           \
+    );                                                                                                                                                              \
+    BOOST_IS_BITWISE_SERIALIZABLE(FullyQualifiedObjectName)
+
 // clang-format on
 
+// Defined in ArchiveSession.h
+template <typename ArchiveT>
+class ArchiveSession;
+
+#if (defined __cpp_lib_memory_resource)
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ArenaDeleter
+///  \brief         Deleter for objects allocated from a std::pmr::memory_resource
+///                 by DeserializePtr; destroys the object and returns its memory
+///                 to the resource. T may be a base class of the allocated object.
+///
+template <typename T>
+class ArenaDeleter {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    ArenaDeleter(void) = default;
+
+    ArenaDeleter(std::pmr::memory_resource &resource, size_t cBytes, size_t alignment) :
+        _pResource(&resource),
+        _cBytes(cBytes),
+        _alignment(alignment)
+    {}
+
+    void operator()(T *pObj) const {
+        void *                              pMemory;
+
+        if constexpr(std::is_polymorphic_v<T>)
+            pMemory = dynamic_cast<void *>(pObj);
+        else
+            pMemory = static_cast<void *>(pObj);
+
+        pObj->~T();
+        _pResource->deallocate(pMemory, _cBytes, _alignment);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::pmr::memory_resource *             _pResource = nullptr;
+    size_t                                  _cBytes = 0;
+    size_t                                  _alignment = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       ArenaUniquePtr
+///  \brief         unique_ptr to an object allocated from a std::pmr::memory_resource
+///                 (see DeserializePtr).
+///
+template <typename T>
+using ArenaUniquePtr                        = std::unique_ptr<T, ArenaDeleter<T>>;
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SchemaField
+///  \brief         Compile-time description of a member serialized by an object
+///                 generated by SERIALIZATION (see SerializationSchema::GetFields).
+///                 The member's location within the object is described by a
+///                 member pointer rather than a byte offset, as offsetof is only
+///                 well-defined for standard layout types.
+///
+///                 deserializePointer refers to the member's value within
+///                 SerializationPOD::DeserializeLocalData, which can be used to
+///                 construct objects from values deserialized independently
+///                 (see SerializeColumns.h).
+///
+template <typename ClassT, typename MemberT, typename DeserializePointerT>
+struct SchemaField {
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using ClassType                         = ClassT;
+    using Type                              = std::remove_cv_t<MemberT>;
+
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    char const * const                      name;
+    MemberT ClassT::* const                 pointer;
+    DeserializePointerT const               deserializePointer;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    constexpr MemberT const & Get(ClassT const &obj) const {
+        return obj.*pointer;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      ForEachSchemaField
+///  \brief         Invokes the functor with each SchemaField of an object generated
+///                 by SERIALIZATION, in the order in which the fields are serialized.
+///                 Fields of base classes are not included; they are available
+///                 via SerializationSchema::BaseTypes.
+///
+///                 Example:
+///                     ForEachSchemaField<MyObj>(
+///                         [&obj](auto const &field) {
+///                             std::cout << field.name << ": " << field.Get(obj) << "\n";
+///                         }
+///                     );
+///
+template <typename T, typename FuncT>
+constexpr void ForEachSchemaField(FuncT &&func) {
+    std::apply(
+        [&func](auto const &... fields) {
+            (func(fields), ...);
+        },
+        T::SerializationSchema::GetFields()
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetSchemaFieldIndex
+///  \brief         Returns the index of the named SchemaField of an object generated
+///                 by SERIALIZATION, or SerializationSchema::NumFields if the
+///                 object doesn't have a field with that name.
+///
+template <typename T>
+constexpr size_t GetSchemaFieldIndex(char const *name) {
+    size_t                                  result(T::SerializationSchema::NumFields);
+    size_t                                  index(0);
+
+    ForEachSchemaField<T>(
+        [&result, &index, name](auto const &field) {
+            if(result == T::SerializationSchema::NumFields && std::string_view(field.name) == name)
+                result = index;
+
+            ++index;
+        }
+    );
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          SchemaFormatFlag
+///  \brief         The flags provided to SERIALIZATION that change the format
+///                 of the serialized data (see SerializationSchema::FormatFlags).
+///                 Other flags (such as SERIALIZATION_DELTA) only add methods
+///                 and aren't included.
+///
+enum class SchemaFormatFlag : unsigned int {
+    SharedObject                            = 1 << 0,   ///< SERIALIZATION_SHARED_OBJECT
+    Abstract                                = 1 << 1,   ///< SERIALIZATION_ABSTRACT
+    PolymorphicBase                         = 1 << 2,   ///< SERIALIZATION_POLYMORPHIC_BASE
+    Polymorphic                             = 1 << 3,   ///< Any object in a polymorphic hierarchy
+    Bitwise                                 = 1 << 4,   ///< SERIALIZATION_DATA_BITWISE
+    PolymorphicTypeIds                      = 1 << 5,   ///< SERIALIZATION_POLYMORPHIC_TYPE_IDS
+    CustomTypes                             = 1 << 6    ///< SERIALIZATION_DATA_CUSTOM_TYPES
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SchemaTypeFingerprint
+///  \brief         Specialize this type with a `static constexpr std::uint64_t const value`
+///                 to describe a member type that GetSchemaFingerprint can't
+///                 describe on its own. Without a specialization, these types
+///                 contribute the same value to the fingerprint regardless of
+///                 their contents.
+///
+template <typename T, typename EnableIfT=void>
+struct SchemaTypeFingerprint;
+
+namespace Details {
+
+template <typename T>
+constexpr std::uint64_t ComputeSchemaFingerprint(void);
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetSchemaFingerprint
+///  \brief         Returns a 64-bit fingerprint of the data serialized for an
+///                 object generated by SERIALIZATION, computed once at compile
+///                 time. The fingerprint covers the type name, version, and format
+///                 flags, the fingerprints of the bases, and the name and type of
+///                 each member (recursively for members generated by SERIALIZATION).
+///
+///                 Member types are described by their structure rather than their
+///                 names so that the value is the same for all compilers: fundamental
+///                 types by kind and size, enums as enums, and std types by the
+///                 interface that they provide (sequences, sets, maps, tuple-like
+///                 types, optional values, and pointers). Objects generated by
+///                 SERIALIZATION that are referenced by pointers contribute their name
+///                 only (as they may refer to the class that contains them), as do
+///                 the fields of classes that use SERIALIZATION_DATA_CUSTOM_TYPES;
+///                 change the class's version when these change. Objects derived
+///                 from a polymorphic base aren't included in the base's fingerprint.
+///
+///                 Peers can exchange fingerprints once (for example, when a connection
+///                 is established) and use compact formats when they match, falling
+///                 back to a self-describing format (such as xml) when they don't:
+///
+///                     if(peerFingerprint == GetSchemaFingerprint<MyObj>())
+///                         obj.Serialize<compact_oarchive>(out);
+///                     else
+///                         obj.Serialize<boost::archive::xml_oarchive>(out);
+///
+template <typename T>
+constexpr std::uint64_t GetSchemaFingerprint(void) {
+    constexpr std::uint64_t const           result(Details::ComputeSchemaFingerprint<T>());
+
+    return result;
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -936,41 +1862,39 @@ void __Ensure_correct_include__See_SERIALIZATION_for_more_info(void);
 
 #endif
 
-/////////////////////////////////////////////////////////////////////////
-///  \struct        DelayInitTag
-///  \brief         Tag used as a constructor argument to indicate that
-///                 the object will be initialized by a derived object
-///                 (which is different from default construction).
-///
-struct DelayInitTag {};
-
 // has_SerializationPOD is used in Serialization.suffix.h.
 CREATE_HAS_TYPE_CHECKER(SerializationPOD);
 
+// Archives that serialize fundamental types as raw bytes (boost's binary archives)
+// advertise this via use_array_optimization.
+CREATE_HAS_TYPE_CHECKER(use_array_optimization);
+
 class Access {
 public:
     // ----------------------------------------------------------------------
     // |  Public Methods
     template <typename T>
-    static void AdditionalVoidCastRegistration(T &obj) {
-        AdditionalVoidCastRegistrationImpl(obj, std::integral_constant<bool, has_AdditionalVoidCastRegistration<T>::value>());
+    static void AdditionalVoidCastRegistration(void) {
+        if constexpr(HasAdditionalVoidCastRegistration<T>::value)
+            T::AdditionalVoidCastRegistration();
+    }
+
+    template <typename T>
+    static std::uint32_t GetPolymorphicTypeId(void) {
+        return T::SERIALIZATION_POLYMORPHIC_TYPE_ID_Impl_Func_Name() ();
     }
 
 private:
     // ----------------------------------------------------------------------
     // |  Private Types
-    CREATE_HAS_METHOD_CHECKER(AdditionalVoidCastRegistration, (void(void)), HAS_METHOD_CHECKER_AS_STATIC_BOOL);
 
-    // ----------------------------------------------------------------------
-    // |  Private Methods
-    template <typename T>
-    static void AdditionalVoidCastRegistrationImpl(T &obj, std::true_type) {
-        obj.AdditionalVoidCastRegistration();
-    }
+    // AdditionalVoidCastRegistration is a static method, as types are registered
+    // before any objects are serialized (see RegisterPolymorphicType).
+    template <typename T, typename = void>
+    struct HasAdditionalVoidCastRegistration : public std::false_type {};
 
     template <typename T>
-    static void AdditionalVoidCastRegistrationImpl(T &, std::false_type) {
-    }
+    struct HasAdditionalVoidCastRegistration<T, std::void_t<decltype(T::AdditionalVoidCastRegistration())>> : public std::true_type {};
 };
 
 // ----------------------------------------------------------------------
@@ -989,7 +1913,7 @@ T CreateMemberImpl(U && data, std::integral_constant<CreateMemberType, CreateMem
 
 template <typename T, typename U>
 T CreateMemberImpl(U && data, std::integral_constant<CreateMemberType, CreateMemberType::SerializationPOD_Standard>) {
-    return data.Construct();
+    return T(std::forward<U>(data));
 }
 
 template <typename T, typename U>
@@ -1010,7 +1934,11 @@ struct SerializeDataTypeImpl_IsPointer<T, false> {
 
 template <typename T, bool>
 struct SerializeDataTypeImpl_HasSerializationPOD {
-    using type                              = typename T::SerializationPOD;
+    using type                              = std::conditional_t<
+        CommonHelpers::TypeTraits::IsSmartPointer<T>,
+        typename T::SerializationPOD,
+        typename T::SerializationPOD::SerializeData
+    >;
 };
 
 template <typename T>
@@ -1024,7 +1952,11 @@ struct SerializeDataTypeImpl : public SerializeDataTypeImpl_HasSerializationPOD<
 // ----------------------------------------------------------------------
 template <typename T, bool>
 struct DeserializeDataTypeImpl_HasSerializationPOD {
-    using type                              = typename T::SerializationPOD;
+    using type                              = std::conditional_t<
+        CommonHelpers::TypeTraits::IsSmartPointer<T>,
+        typename T::SerializationPOD,
+        typename T::SerializationPOD::DeserializeData
+    >;
 };
 
 template <typename T>
@@ -1068,6 +2000,25 @@ std::remove_const_t<T> CreateMember(U && data) {
     );
 }
 
+/////////////////////////////////////////////////////////////////////////
+///  \function      LendMemberStorage
+///  \brief         Moves a member into the data used to deserialize it when
+///                 the data is of the same type (which isn't the case for
+///                 members generated by SERIALIZATION or pointers), so that
+///                 the member's storage is reused when the data is read (see
+///                 SERIALIZATION_DESERIALIZE_INTO). The members of nested
+///                 SERIALIZATION objects are moved into their data.
+///
+template <typename T, typename DataT>
+void LendMemberStorage(T &member, DataT &data) {
+    using Type                              = std::remove_const_t<T>;
+
+    if constexpr(std::is_same_v<Type, DataT> && std::is_pointer_v<DataT> == false)
+        data = std::move(const_cast<DataT &>(member));
+    else if constexpr(has_SerializationPOD<Type> && CommonHelpers::TypeTraits::IsSmartPointer<Type> == false)
+        Type::SerializationPOD::LendStorage(const_cast<Type &>(member), data);
+}
+
 /////////////////////////////////////////////////////////////////////////
 ///  \typedef       SerializeDataType
 ///  \brief         Determines the best type to use in the process of
@@ -1084,6 +2035,1536 @@ using SerializeDataType                     = typename Details::SerializeDataTyp
 template <typename T>
 using DeserializeDataType                   = typename Details::DeserializeDataTypeImpl<std::remove_const_t<T>>::type;
 
+/////////////////////////////////////////////////////////////////////////
+///  \var           DependentValue
+///  \brief         Value that depends on T, so that static_asserts within
+///                 templates are only evaluated when the template is
+///                 instantiated.
+///
+template <typename T, bool ValueV>
+constexpr bool const DependentValue         = ValueV;
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      IsDeltaMember
+///  \brief         Returns true if members of type T can be read by
+///                 SERIALIZATION_DELTA, which requires that unchanged members
+///                 can be moved into the data used to deserialize them (see
+///                 LendMemberStorage).
+///
+template <typename T>
+constexpr bool IsDeltaMember(void) {
+    using Type                              = std::remove_const_t<T>;
+
+    if constexpr(has_SerializationPOD<Type> && CommonHelpers::TypeTraits::IsSmartPointer<Type> == false)
+        return Type::SerializationPOD::SupportsDelta;
+    else
+        return std::is_same_v<DeserializeDataType<Type>, Type> && std::is_pointer_v<Type> == false;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      IsDeltaEqual
+///  \brief         Returns true if a member is unchanged from its value in
+///                 the baseline object (see SERIALIZATION_DELTA).
+///
+template <typename T>
+bool IsDeltaEqual(T const &value, T const &baseline) {
+    if constexpr(has_SerializationPOD<T> && CommonHelpers::TypeTraits::IsSmartPointer<T> == false)
+        return T::SerializationPOD::template HasDeltaChanges<T>(value, baseline) == false;
+    else if constexpr(CommonHelpers::TypeTraits::IsSmartPointer<T>) {
+        using ElementType                   = std::remove_cv_t<typename T::element_type>;
+
+        if(value == baseline)
+            return true;
+
+        if(!value || !baseline)
+            return false;
+
+        // The members of derived classes aren't visible via the base class
+        if constexpr(std::is_polymorphic_v<ElementType>)
+            return false;
+        else
+            return IsDeltaEqual<ElementType>(*value, *baseline);
+    }
+    else
+        return value == baseline;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           IgnoresSerializationNames
+///  \brief         True if the archive doesn't write the names provided by
+///                 name-value pairs, in which case SaveNamed and LoadNamed
+///                 skip the nvp wrapper. Archives are assumed to use names
+///                 unless they are known not to (xml and polymorphic archives
+///                 keep the wrapper); specialize this value for other archives
+///                 that ignore names (see CompactArchive.h).
+///
+template <typename ArchiveT>
+constexpr bool const IgnoresSerializationNames =
+    std::is_base_of_v<boost::archive::basic_binary_oarchive<ArchiveT>, ArchiveT>
+    || std::is_base_of_v<boost::archive::basic_binary_iarchive<ArchiveT>, ArchiveT>
+    || std::is_base_of_v<boost::archive::basic_text_oarchive<ArchiveT>, ArchiveT>
+    || std::is_base_of_v<boost::archive::basic_text_iarchive<ArchiveT>, ArchiveT>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SaveNamed
+///  \brief         Writes the value as a name-value pair, or as the value
+///                 alone when the archive ignores names (the output is the
+///                 same).
+///
+template <typename ArchiveT, typename T>
+void SaveNamed(ArchiveT &ar, char const *name, T const &value) {
+    if constexpr(IgnoresSerializationNames<ArchiveT>) {
+        UNUSED(name);
+        ar << value;
+    }
+    else
+        ar << boost::serialization::make_nvp(name, value);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      LoadNamed
+///  \brief         Reads a value written by SaveNamed.
+///
+template <typename ArchiveT, typename T>
+void LoadNamed(ArchiveT &ar, char const *name, T &value) {
+    if constexpr(IgnoresSerializationNames<ArchiveT>) {
+        UNUSED(name);
+        ar >> value;
+    }
+    else
+        ar >> boost::serialization::make_nvp(name, value);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SerializationDataTraits
+///  \brief         Boost serialization traits for the SerializeData and
+///                 DeserializeData types generated by SERIALIZATION. These
+///                 types are serialized as objects without class information
+///                 or tracking, so they don't add anything to the output
+///                 beyond the data that they contain.
+///
+template <typename T>
+struct SerializationDataTraits : public boost::serialization::basic_traits {
+    using level                             = boost::mpl::int_<boost::serialization::object_serializable>;
+    using tracking                          = boost::mpl::int_<boost::serialization::track_never>;
+    using version                           = boost::mpl::int_<0>;
+    using type_info_implementation          = boost::serialization::extended_type_info_impl<T>;
+    using is_wrapper                        = boost::mpl::false_;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        VersionedSerializationDataTraits
+///  \brief         Serialization traits for data types whose version is written
+///                 by boost the first time that they are encountered within an
+///                 archive (see SERIALIZATION_VERSION).
+///
+template <typename T, unsigned int VersionV>
+struct VersionedSerializationDataTraits : public SerializationDataTraits<T> {
+    static_assert(VersionV > 0 && VersionV <= 255, "SERIALIZATION_VERSION must be between 1 and 255");
+
+    using level                             = boost::mpl::int_<boost::serialization::object_class_info>;
+    using version                           = boost::mpl::int_<VersionV>;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         VersionedSaveData
+///  \brief         Writes the SerializeLocalData of a type declared with
+///                 SERIALIZATION_VERSION.
+///
+template <typename LocalDataT, unsigned int VersionV>
+class VersionedSaveData : public VersionedSerializationDataTraits<VersionedSaveData<LocalDataT, VersionV>, VersionV> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    explicit VersionedSaveData(LocalDataT const &data) : _data(data) {}
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    LocalDataT const &                      _data;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    friend class boost::serialization::access;
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+    template <typename ArchiveT>
+    void save(ArchiveT &ar, unsigned int const) const {
+        _data.ExecuteVersioned(ar);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         VersionedLoadData
+///  \brief         Reads the DeserializeLocalData of a type declared with
+///                 SERIALIZATION_VERSION, providing it with the version read
+///                 from the archive.
+///
+template <typename LocalDataT, unsigned int VersionV>
+class VersionedLoadData : public VersionedSerializationDataTraits<VersionedLoadData<LocalDataT, VersionV>, VersionV> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    explicit VersionedLoadData(LocalDataT &data) : _data(data) {}
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    LocalDataT &                            _data;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    friend class boost::serialization::access;
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+    template <typename ArchiveT>
+    void load(ArchiveT &ar, unsigned int const version) {
+        // boost doesn't validate versions read from the archive
+        if(version > VersionV)
+            throw std::runtime_error("The archive was written with a newer version of the type");
+
+        _data.ExecuteVersioned(ar, version);
+    }
+};
+
+template <unsigned int VersionV, typename ArchiveT, typename LocalDataT>
+void SaveVersionedLocalData(ArchiveT &ar, LocalDataT const &data) {
+    VersionedSaveData<LocalDataT, VersionV> const       versioned(data);
+
+    SaveNamed(ar, "versioned", versioned);
+}
+
+template <unsigned int VersionV, typename ArchiveT, typename LocalDataT>
+void LoadVersionedLocalData(ArchiveT &ar, LocalDataT &data) {
+    VersionedLoadData<LocalDataT, VersionV>             versioned(data);
+
+    LoadNamed(ar, "versioned", versioned);
+}
+
+/// A member added to a class declared with SERIALIZATION_VERSION (see SERIALIZATION_MEMBERS_SINCE)
+struct MemberSinceVersion {
+    char const *                            name;
+    unsigned int                            version;
+};
+
+constexpr unsigned int GetMemberSinceVersion(char const *name, std::initializer_list<MemberSinceVersion> members) {
+    for(MemberSinceVersion const &member : members) {
+        if(std::string_view(member.name) == name)
+            return member.version;
+    }
+
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SerializeView
+///  \brief         SerializeData for a type generated by SERIALIZATION; refers
+///                 to the object being saved and writes it via the
+///                 SerializationPOD's Save method. Bases and nested
+///                 SERIALIZATION members are written through views of their
+///                 own, so saving an object never creates copies of (or
+///                 intermediate structures for) the data that it contains.
+///
+template <typename T>
+class SerializeView : public SerializationDataTraits<SerializeView<T>> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    explicit SerializeView(T const &obj) : _pObj(&obj) {}
+
+    template <typename ArchiveT>
+    void Execute(ArchiveT &ar) const {
+        T::SerializationPOD::Save(ar, *_pObj);
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    T const *                               _pObj;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    friend class boost::serialization::access;
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+    template <typename ArchiveT>
+    void save(ArchiveT &ar, unsigned int const) const {
+        Execute(ar);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SaveView
+///  \brief         Writes the object as a named SerializeView of type T
+///                 (which is used to write an object as one of its bases).
+///
+template <typename T, typename ArchiveT>
+void SaveView(ArchiveT &ar, char const *name, T const &obj) {
+    SerializeView<T> const                  view(obj);
+
+    SaveNamed(ar, name, view);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SaveDeltaMember
+///  \brief         Writes a member that has changed from its value in the
+///                 baseline object; nested SERIALIZATION objects are written
+///                 as deltas.
+///
+template <typename ArchiveT, typename T>
+void SaveDeltaMember(ArchiveT &ar, char const *name, T const &value, T const &baseline) {
+    if constexpr(has_SerializationPOD<T> && CommonHelpers::TypeTraits::IsSmartPointer<T> == false) {
+        UNUSED(name);
+        T::SerializationPOD::SaveDelta(ar, value, baseline);
+    }
+    else {
+        UNUSED(baseline);
+
+        std::add_const_t<SerializeDataType<T>>          data(value);
+
+        SaveNamed(ar, name, data);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      LoadDeltaMember
+///  \brief         Reads a member written by SaveDeltaMember into the data
+///                 used to deserialize it; the bitmaps of nested SERIALIZATION
+///                 objects are appended to masks.
+///
+template <typename T, typename ArchiveT, typename DataT>
+void LoadDeltaMember(ArchiveT &ar, char const *name, DataT &data, std::vector<std::uint64_t> &masks) {
+    using Type                              = std::remove_const_t<T>;
+
+    if constexpr(has_SerializationPOD<Type> && CommonHelpers::TypeTraits::IsSmartPointer<Type> == false) {
+        UNUSED(name);
+        Type::SerializationPOD::LoadDelta(ar, data, masks);
+    }
+    else {
+        UNUSED(masks);
+        LoadNamed(ar, name, data);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      LendDeltaMemberStorage
+///  \brief         Moves the unchanged members of a nested SERIALIZATION
+///                 object that was read by LoadDeltaMember into its data (see
+///                 LendMemberStorage); other changed members were read in
+///                 their entirety and are left as is.
+///
+template <typename T, typename DataT>
+void LendDeltaMemberStorage(T &member, DataT &data, std::vector<std::uint64_t> const &masks, size_t &maskIndex) {
+    using Type                              = std::remove_const_t<T>;
+
+    if constexpr(has_SerializationPOD<Type> && CommonHelpers::TypeTraits::IsSmartPointer<Type> == false)
+        Type::SerializationPOD::LendDeltaStorage(const_cast<Type &>(member), data, masks, maskIndex);
+    else {
+        UNUSED(member);
+        UNUSED(data);
+        UNUSED(masks);
+        UNUSED(maskIndex);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SaveDeltaMask
+///  \brief         Writes the bitmap of changed members using only as many
+///                 bytes as are needed for the class's members.
+///
+template <size_t NumMembers, typename ArchiveT>
+void SaveDeltaMask(ArchiveT &ar, std::uint64_t mask) {
+    for(size_t index = 0; index < (NumMembers + 7) / 8; ++index) {
+        std::uint8_t const                  byte(static_cast<std::uint8_t>(mask >> (index * 8)));
+
+        SaveNamed(ar, "changed", byte);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      LoadDeltaMask
+///  \brief         Reads a bitmap written by SaveDeltaMask.
+///
+template <size_t NumMembers, typename ArchiveT>
+std::uint64_t LoadDeltaMask(ArchiveT &ar) {
+    std::uint64_t                           result(0);
+
+    for(size_t index = 0; index < (NumMembers + 7) / 8; ++index) {
+        std::uint8_t                        byte(0);
+
+        LoadNamed(ar, "changed", byte);
+        result |= static_cast<std::uint64_t>(byte) << (index * 8);
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetNumTypeRegistrations
+///  \brief         Returns the number of times that type information has been
+///                 registered with boost by RegisterOnce. Polymorphic types are
+///                 registered by SERIALIZATION_POLYMORPHIC_DEFINE during static
+///                 initialization, so this value remains constant once main
+///                 has been entered.
+///
+inline std::atomic<size_t> & GetNumTypeRegistrations(void) {
+    static std::atomic<size_t>              numRegistrations(0);
+
+    return numRegistrations;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      RegisterOnce
+///  \brief         Invokes the functor the first time that it is called for T.
+///                 Registration with boost's void_cast and type registries
+///                 would otherwise be repeated every time that a polymorphic
+///                 object is saved or loaded; once the (thread safe)
+///                 initialization of the static has completed, subsequent
+///                 calls only check that it has been initialized.
+///
+template <typename T, typename FuncT>
+void RegisterOnce(FuncT const &func) {
+    static bool const                       isRegistered(
+        [&func](void) {
+            func();
+            ++GetNumTypeRegistrations();
+
+            return true;
+        }()
+    );
+
+    UNUSED(isRegistered);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      RegisterSerializationPODBaseClass
+///  \brief         Registers the relationship between a SerializationPOD
+///                 and the SerializationPOD of a base class, which boost
+///                 requires when a SerializationPOD is serialized via a pointer
+///                 to a base class. This is only necessary for polymorphic
+///                 types.
+///
+template <typename SerializationPODT, typename BaseSerializationPODT>
+void RegisterSerializationPODBaseClass(void) {
+    if constexpr(std::is_polymorphic_v<BaseSerializationPODT>) {
+        boost::serialization::void_cast_register(
+            static_cast<SerializationPODT const *>(nullptr),
+            static_cast<BaseSerializationPODT const *>(nullptr)
+        );
+
+        BaseSerializationPODT::RegisterBaseClasses();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           IsBitwiseArchive
+///  \brief         True if the archive serializes fundamental types as raw
+///                 bytes, meaning that a block of trivially copyable members
+///                 can be written via a single save_binary/load_binary call
+///                 without changing the archive's output.
+///
+template <typename ArchiveT>
+constexpr bool const IsBitwiseArchive = has_use_array_optimization<ArchiveT>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           NoPolymorphicTypeId
+///  \brief         The id of types declared with SERIALIZATION_POLYMORPHIC_DECLARE
+///                 (rather than SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID).
+///
+constexpr std::uint32_t const NoPolymorphicTypeId = std::numeric_limits<std::uint32_t>::max();
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           MaxPolymorphicTypeId
+///  \brief         Ids provided to SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID must
+///                 be less than this value, as they are used to index into a
+///                 flat table.
+///
+constexpr std::uint32_t const MaxPolymorphicTypeId = 1 << 16;
+
+template <typename SerializationPODT, typename = void>
+constexpr bool const UsesPolymorphicTypeIdsImpl = false;
+
+template <typename SerializationPODT>
+constexpr bool const UsesPolymorphicTypeIdsImpl<SerializationPODT, std::void_t<decltype(SerializationPODT::UsesPolymorphicTypeIds)>> = SerializationPODT::UsesPolymorphicTypeIds;
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           UsesPolymorphicTypeIds
+///  \brief         True if T is part of a hierarchy whose root was declared
+///                 with the SERIALIZATION_POLYMORPHIC_TYPE_IDS flag.
+///
+template <typename T>
+constexpr bool const UsesPolymorphicTypeIds = UsesPolymorphicTypeIdsImpl<typename T::SerializationPOD>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PolymorphicTypeIds
+///  \brief         Table of the concrete SerializationPOD types registered for
+///                 a hierarchy (via SERIALIZATION_POLYMORPHIC_DEFINE), indexed
+///                 by the id provided to SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID.
+///
+///                 Objects are still written and read by the serializers that
+///                 boost creates for each archive as part of BOOST_CLASS_EXPORT_IMPLEMENT;
+///                 the table replaces the class name (and the lookup by name)
+///                 that boost would otherwise use to find them.
+///
+template <typename BaseSerializationPODT>
+class PolymorphicTypeIds {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    struct Type {
+        boost::serialization::extended_type_info const *        pTypeInfo = nullptr;
+        BaseSerializationPODT * (*pCreateFunc)(void) = nullptr;
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    template <typename SerializationPODT>
+    static bool Register(std::uint32_t id) {
+        if(id >= MaxPolymorphicTypeId)
+            throw std::logic_error("Invalid polymorphic type id");
+
+        std::vector<Type> &                 types(GetTypes());
+
+        if(id >= types.size())
+            types.resize(id + 1);
+
+        Type &                              type(types[id]);
+
+        if(type.pTypeInfo != nullptr)
+            throw std::logic_error("The polymorphic type id has already been registered");
+
+        type.pTypeInfo = &boost::serialization::type_info_implementation<SerializationPODT>::type::get_const_instance();
+        type.pCreateFunc = [](void) -> BaseSerializationPODT * { return new SerializationPODT(); };
+
+        return true;
+    }
+
+    static Type const & Get(std::uint32_t id) {
+        std::vector<Type> const &           types(GetTypes());
+
+        if(id >= types.size() || types[id].pTypeInfo == nullptr)
+            throw std::runtime_error("Invalid polymorphic type id");
+
+        return types[id];
+    }
+
+    /// Returns the boost serializer for the type associated with the id; these
+    /// are cached per archive type when first requested, as all types have been
+    /// registered during static initialization.
+    template <typename ArchiveT, typename PointerSerializerT>
+    static auto const & GetSerializer(std::uint32_t id) {
+        static std::vector<PointerSerializerT const *> const    serializers(
+            [](void) {
+                std::vector<PointerSerializerT const *>         result;
+
+                for(Type const &type : GetTypes())
+                    result.emplace_back(type.pTypeInfo ? Find<ArchiveT, PointerSerializerT>(*type.pTypeInfo) : nullptr);
+
+                return result;
+            }()
+        );
+
+        PointerSerializerT const *          pSerializer(id < serializers.size() ? serializers[id] : nullptr);
+
+        if(pSerializer == nullptr)
+            pSerializer = Find<ArchiveT, PointerSerializerT>(*Get(id).pTypeInfo);
+
+        if(pSerializer == nullptr)
+            throw std::runtime_error("The polymorphic type has not been exported for this archive (see SERIALIZATION_POLYMORPHIC_DEFINE)");
+
+        return pSerializer->get_basic_serializer();
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    static std::vector<Type> & GetTypes(void) {
+        static std::vector<Type>            types;
+
+        return types;
+    }
+
+    template <typename ArchiveT, typename PointerSerializerT>
+    static PointerSerializerT const * Find(boost::serialization::extended_type_info const &typeInfo) {
+        return static_cast<PointerSerializerT const *>(boost::archive::detail::archive_serializer_map<ArchiveT>::find(typeInfo));
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SavePolymorphicTypeId
+///  \brief         Writes a polymorphic type id; archives that write raw bytes
+///                 store the id as a variable length integer (7 bits per byte),
+///                 so ids less than 128 require a single byte.
+///
+template <typename ArchiveT>
+void SavePolymorphicTypeId(ArchiveT &ar, std::uint32_t id) {
+    if constexpr(IsBitwiseArchive<ArchiveT>) {
+        unsigned char                       buffer[5];
+        size_t                              cBytes(0);
+
+        do {
+            buffer[cBytes] = static_cast<unsigned char>(id & 0x7F);
+            id >>= 7;
+
+            if(id)
+                buffer[cBytes] |= 0x80;
+
+            ++cBytes;
+        } while(id);
+
+        ar.save_binary(buffer, cBytes);
+    }
+    else
+        SaveNamed(ar, "type", id);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      LoadPolymorphicTypeId
+///  \brief         Reads a polymorphic type id written by SavePolymorphicTypeId.
+///
+template <typename ArchiveT>
+std::uint32_t LoadPolymorphicTypeId(ArchiveT &ar) {
+    std::uint32_t                           id(0);
+
+    if constexpr(IsBitwiseArchive<ArchiveT>) {
+        unsigned int                        shift(0);
+
+        while(true) {
+            unsigned char                   byte;
+
+            ar.load_binary(&byte, 1);
+            id |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+
+            if((byte & 0x80) == 0)
+                break;
+
+            shift += 7;
+            if(shift >= 32)
+                throw std::runtime_error("Invalid polymorphic type id");
+        }
+    }
+    else
+        LoadNamed(ar, "type", id);
+
+    return id;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PolymorphicTypeIdSaveData
+///  \brief         Writes a polymorphic SerializationPOD as its type id followed
+///                 by its data.
+///
+template <typename BaseSerializationPODT>
+class PolymorphicTypeIdSaveData : public SerializationDataTraits<PolymorphicTypeIdSaveData<BaseSerializationPODT>> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    PolymorphicTypeIdSaveData(std::uint32_t id, BaseSerializationPODT const &pod) :
+        _id(id),
+        _pod(pod)
+    {}
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::uint32_t const                     _id;
+    BaseSerializationPODT const &           _pod;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    friend class boost::serialization::access;
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+    template <typename ArchiveT>
+    void save(ArchiveT &ar, unsigned int const) const {
+        if(_id == NoPolymorphicTypeId)
+            throw std::logic_error("The type was not declared with SERIALIZATION_POLYMORPHIC_DECLARE_WITH_ID");
+
+        SavePolymorphicTypeId(ar, _id);
+
+        static_cast<boost::archive::detail::basic_oarchive &>(ar).save_object(
+            dynamic_cast<void const *>(&_pod),
+            PolymorphicTypeIds<BaseSerializationPODT>::template GetSerializer<ArchiveT, boost::archive::detail::basic_pointer_oserializer>(_id)
+        );
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PolymorphicTypeIdLoadData
+///  \brief         Reads a polymorphic SerializationPOD written by
+///                 PolymorphicTypeIdSaveData.
+///
+template <typename BaseSerializationPODT>
+class PolymorphicTypeIdLoadData : public SerializationDataTraits<PolymorphicTypeIdLoadData<BaseSerializationPODT>> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    PolymorphicTypeIdLoadData(std::unique_ptr<BaseSerializationPODT> &pPod) :
+        _pPod(pPod)
+    {}
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::unique_ptr<BaseSerializationPODT> &                _pPod;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    friend class boost::serialization::access;
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+    template <typename ArchiveT>
+    void load(ArchiveT &ar, unsigned int const) {
+        using Types                         = PolymorphicTypeIds<BaseSerializationPODT>;
+
+        std::uint32_t const                 id(LoadPolymorphicTypeId(ar));
+        auto const &                        serializer(Types::template GetSerializer<ArchiveT, boost::archive::detail::basic_pointer_iserializer>(id));
+
+        _pPod.reset(Types::Get(id).pCreateFunc());
+
+        static_cast<boost::archive::detail::basic_iarchive &>(ar).load_object(dynamic_cast<void *>(_pPod.get()), serializer);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SavePolymorphicPtr
+///  \brief         Writes the SerializationPOD created for a polymorphic object
+///                 by SerializePtr, either as a boost pointer (which includes
+///                 the class name) or with its polymorphic type id.
+///
+template <typename ArchiveT, typename T, typename SerializationPODT>
+void SavePolymorphicPtr(ArchiveT &ar, char const *tag, T const &obj, std::unique_ptr<SerializationPODT> const &pPod) {
+    if constexpr(UsesPolymorphicTypeIdsImpl<SerializationPODT>) {
+        PolymorphicTypeIdSaveData<SerializationPODT> const  data(obj.GetSerializationPolymorphicTypeId(), *pPod);
+
+        SaveNamed(ar, tag, data);
+    }
+    else {
+        UNUSED(obj);
+        SaveNamed(ar, tag, pPod);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      LoadPolymorphicPtr
+///  \brief         Reads a SerializationPOD written by SavePolymorphicPtr.
+///
+template <typename SerializationPODT, typename ArchiveT>
+std::unique_ptr<SerializationPODT> LoadPolymorphicPtr(ArchiveT &ar, char const *tag) {
+    std::unique_ptr<SerializationPODT>      pPod;
+
+    if constexpr(UsesPolymorphicTypeIdsImpl<SerializationPODT>) {
+        PolymorphicTypeIdLoadData<SerializationPODT>        data(pPod);
+
+        LoadNamed(ar, tag, data);
+    }
+    else
+        LoadNamed(ar, tag, pPod);
+
+    return pPod;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      RegisterPolymorphicType
+///  \brief         Registers the relationships between a concrete polymorphic
+///                 type, its SerializationPOD, and their bases with boost. This
+///                 is invoked by SERIALIZATION_POLYMORPHIC_DEFINE during static
+///                 initialization (and by RegisterSerializationTypes, which
+///                 only checks that registration has completed), so that
+///                 boost's void_cast registry is never modified while objects
+///                 are being serialized on other threads.
+///
+template <typename T>
+void RegisterPolymorphicType(void) {
+    RegisterOnce<T>(
+        [](void) {
+            boost::serialization::void_cast_register(
+                static_cast<T const *>(nullptr),
+                static_cast<typename T::PolymorphicSerializationBase const *>(nullptr)
+            );
+
+            Access::AdditionalVoidCastRegistration<T>();
+            T::SerializationPOD::RegisterBaseClasses();
+        }
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PolymorphicRegistration
+///  \brief         IsRegistered is defined by SERIALIZATION_POLYMORPHIC_DEFINE,
+///                 which registers the type with boost (and adds it to its
+///                 hierarchy's PolymorphicTypeIds) during static initialization.
+///
+template <typename T>
+struct PolymorphicRegistration {
+    static bool const                       IsRegistered;
+};
+
+template <typename T>
+bool RegisterPolymorphicDefinition(void) {
+    if constexpr(std::is_abstract_v<T> == false) {
+        RegisterPolymorphicType<T>();
+
+        if constexpr(UsesPolymorphicTypeIds<T>) {
+            using BaseSerializationPOD      = typename T::PolymorphicSerializationBase::SerializationPOD;
+
+            PolymorphicTypeIds<BaseSerializationPOD>::template Register<typename T::SerializationPOD>(Access::GetPolymorphicTypeId<T>());
+        }
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           IsBitwiseMember
+///  \brief         True if the member type can be serialized as raw bytes
+///                 (see SERIALIZATION_DATA_BITWISE).
+///
+template <typename T>
+constexpr bool const IsBitwiseMember = std::is_trivially_copyable_v<T> && std::is_pointer_v<T> == false;
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           BitwiseMemberSize
+///  \brief         Number of bytes written for a member by SaveBitwise.
+///
+template <typename T>
+constexpr size_t const BitwiseMemberSize = std::is_enum_v<T> ? sizeof(int) : sizeof(T); // boost archives serialize enums as ints
+
+template <typename T>
+void SaveBitwiseMember(unsigned char *&ptr, T const &member) {
+    if constexpr(std::is_enum_v<T>) {
+        int const                           value(static_cast<int>(member));
+
+        std::memcpy(ptr, &value, sizeof(value));
+    }
+    else
+        std::memcpy(ptr, &member, sizeof(T));
+
+    ptr += BitwiseMemberSize<T>;
+}
+
+template <typename T>
+void LoadBitwiseMember(unsigned char const *&ptr, T &member) {
+    if constexpr(std::is_enum_v<T>) {
+        int                                 value;
+
+        std::memcpy(&value, ptr, sizeof(value));
+        member = static_cast<T>(value);
+    }
+    else
+        std::memcpy(&member, ptr, sizeof(T));
+
+    ptr += BitwiseMemberSize<T>;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SaveBitwise
+///  \brief         Writes the provided members as a single block of bytes.
+///
+template <typename ArchiveT, typename... MemberTs>
+void SaveBitwise(ArchiveT &ar, MemberTs const &... members) {
+    unsigned char                           buffer[(BitwiseMemberSize<MemberTs> + ...)];
+    unsigned char *                         ptr(buffer);
+
+    (SaveBitwiseMember(ptr, members), ...);
+    ar.save_binary(buffer, sizeof(buffer));
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      LoadBitwise
+///  \brief         Reads the provided members from a single block of bytes
+///                 written by SaveBitwise.
+///
+template <typename ArchiveT, typename... MemberTs>
+void LoadBitwise(ArchiveT &ar, MemberTs &... members) {
+    unsigned char                           buffer[(BitwiseMemberSize<MemberTs> + ...)];
+    unsigned char const *                   ptr(buffer);
+
+    ar.load_binary(buffer, sizeof(buffer));
+    (LoadBitwiseMember(ptr, members), ...);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \var           UnboundedSerializedSize
+///  \brief         Value of SerializedSizeUpperBound when the serialized size
+///                 of a type cannot be determined at compile time (for example,
+///                 when the type contains strings or containers, or when the
+///                 archive doesn't serialize fundamental types as raw bytes).
+///
+constexpr size_t const UnboundedSerializedSize = std::numeric_limits<size_t>::max();
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      AddSerializedSizeUpperBounds
+///  \brief         Adds the provided sizes, where the result is
+///                 UnboundedSerializedSize if any of the sizes are unbounded.
+///
+constexpr size_t AddSerializedSizeUpperBounds(std::initializer_list<size_t> sizes) {
+    size_t                                  result(0);
+
+    for(size_t size : sizes) {
+        if(size == UnboundedSerializedSize)
+            return UnboundedSerializedSize;
+
+        result += size;
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetSerializedSizeUpperBound
+///  \brief         Returns the number of bytes written when T is serialized
+///                 with ArchiveT, or UnboundedSerializedSize if this value
+///                 cannot be determined at compile time.
+///
+template <typename ArchiveT, typename T>
+constexpr size_t GetSerializedSizeUpperBound(void) {
+    if constexpr(IsBitwiseArchive<ArchiveT> == false)
+        return UnboundedSerializedSize;
+    else if constexpr(std::is_arithmetic_v<T>)
+        return sizeof(T);
+    else if constexpr(std::is_enum_v<T>)
+        return sizeof(int); // boost archives serialize enums as ints
+    else if constexpr(has_SerializationPOD<T> && CommonHelpers::TypeTraits::IsSmartPointer<T> == false)
+        return T::SerializationPOD::template SerializedSizeUpperBound<ArchiveT>;
+    else
+        return UnboundedSerializedSize;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetLocalDataSerializedSizeUpperBound
+///  \brief         Returns the number of bytes written when the members are
+///                 serialized by SerializeLocalData's Execute method.
+///
+template <typename ArchiveT, bool IsBitwiseV, typename... MemberTs>
+constexpr size_t GetLocalDataSerializedSizeUpperBound(void) {
+    if constexpr(IsBitwiseArchive<ArchiveT> == false)
+        return UnboundedSerializedSize;
+    else if constexpr(IsBitwiseV)
+        return (BitwiseMemberSize<MemberTs> + ... + 0);
+    else
+        return AddSerializedSizeUpperBounds({ size_t(0), GetSerializedSizeUpperBound<ArchiveT, MemberTs>()... });
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      IsArchiveStatelessMember
+///  \brief         Returns true if serializing T never adds state (tracked
+///                 objects or class information) to an archive, meaning that
+///                 the output doesn't depend on what was serialized before it.
+///
+template <typename T>
+constexpr bool IsArchiveStatelessMember(void) {
+    if constexpr(has_SerializationPOD<T> && CommonHelpers::TypeTraits::IsSmartPointer<T> == false)
+        return T::SerializationPOD::IsArchiveStateless;
+    else
+        return boost::serialization::implementation_level<T>::value == boost::serialization::primitive_type;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      AreArchiveStatelessMembers
+///  \brief         Returns true if IsArchiveStatelessMember is true for
+///                 all of the members.
+///
+template <typename... MemberTs>
+constexpr bool AreArchiveStatelessMembers(void) {
+    return (IsArchiveStatelessMember<MemberTs>() && ...);
+}
+
+// FNV-1a
+constexpr std::uint64_t const               SchemaFingerprintBasis = 14695981039346656037ull;
+constexpr std::uint64_t const               SchemaFingerprintPrime = 1099511628211ull;
+
+constexpr std::uint64_t AddSchemaFingerprintValue(std::uint64_t hash, std::uint64_t value) {
+    for(size_t index = 0; index < sizeof(value); ++index) {
+        hash = (hash ^ (value & 0xFF)) * SchemaFingerprintPrime;
+        value >>= 8;
+    }
+
+    return hash;
+}
+
+constexpr std::uint64_t AddSchemaFingerprintString(std::uint64_t hash, char const *value) {
+    while(*value) {
+        hash = (hash ^ static_cast<unsigned char>(*value)) * SchemaFingerprintPrime;
+        ++value;
+    }
+
+    // Include the terminator so that consecutive strings can't run together
+    return hash * SchemaFingerprintPrime;
+}
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const HasSchemaTypeFingerprint = false;
+
+template <typename T>
+constexpr bool const HasSchemaTypeFingerprint<T, std::void_t<decltype(SchemaTypeFingerprint<T>::value)>> = true;
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsSchemaTupleLike      = false;
+
+template <typename T>
+constexpr bool const IsSchemaTupleLike<T, std::void_t<decltype(std::tuple_size<T>::value)>> = true;
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsSchemaPointer        = false;
+
+template <typename T>
+constexpr bool const IsSchemaPointer<T, std::void_t<typename T::element_type>> = true;
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsSchemaRange          = false;
+
+template <typename T>
+constexpr bool const IsSchemaRange<T, std::void_t<typename T::value_type, decltype(std::declval<T const &>().begin())>> = true;
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsSchemaMap            = false;
+
+template <typename T>
+constexpr bool const IsSchemaMap<T, std::void_t<typename T::key_type, typename T::mapped_type>> = true;
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsSchemaSet            = false;
+
+template <typename T>
+constexpr bool const IsSchemaSet<T, std::void_t<typename T::key_type>> = true;
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsSchemaOptional       = false;
+
+template <typename T>
+constexpr bool const IsSchemaOptional<T, std::void_t<typename T::value_type, decltype(std::declval<T const &>().has_value())>> = true;
+
+template <typename T>
+constexpr std::uint64_t AddSchemaTypeFingerprint(std::uint64_t hash);
+
+template <typename T, size_t... IndexVs>
+constexpr std::uint64_t AddSchemaTupleFingerprint(std::uint64_t hash, std::index_sequence<IndexVs...>) {
+    ((hash = AddSchemaTypeFingerprint<std::tuple_element_t<IndexVs, T>>(hash)), ...);
+    return hash;
+}
+
+template <typename TupleT, size_t... IndexVs>
+constexpr std::uint64_t AddSchemaBaseFingerprints(std::uint64_t hash, std::index_sequence<IndexVs...>) {
+    ((hash = AddSchemaFingerprintValue(hash, ComputeSchemaFingerprint<std::tuple_element_t<IndexVs, TupleT>>())), ...);
+    return hash;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      AddSchemaTypeFingerprint
+///  \brief         Adds a description of a member's type to the fingerprint
+///                 (see GetSchemaFingerprint).
+///
+template <typename T>
+constexpr std::uint64_t AddSchemaTypeFingerprint(std::uint64_t hash) {
+    using Type                              = std::remove_cv_t<T>;
+
+    if constexpr(HasSchemaTypeFingerprint<Type>)
+        return AddSchemaFingerprintValue(AddSchemaFingerprintString(hash, "custom"), SchemaTypeFingerprint<Type>::value);
+    else if constexpr(has_SerializationPOD<Type> && CommonHelpers::TypeTraits::IsSmartPointer<Type> == false)
+        return AddSchemaFingerprintValue(AddSchemaFingerprintString(hash, "object"), ComputeSchemaFingerprint<Type>());
+    else if constexpr(std::is_same_v<Type, bool>)
+        return AddSchemaFingerprintString(hash, "bool");
+    else if constexpr(std::is_same_v<Type, char>)
+        return AddSchemaFingerprintString(hash, "char"); // The signedness of char varies by platform
+    else if constexpr(std::is_integral_v<Type>)
+        return AddSchemaFingerprintValue(AddSchemaFingerprintString(hash, std::is_signed_v<Type> ? "int" : "uint"), sizeof(Type));
+    else if constexpr(std::is_floating_point_v<Type>)
+        return AddSchemaFingerprintValue(AddSchemaFingerprintString(hash, "float"), sizeof(Type));
+    else if constexpr(std::is_enum_v<Type>) {
+        // Boost archives serialize enums as ints, but columns (see SerializeColumns)
+        // are written as raw bytes, so the underlying type is part of the format.
+        using UnderlyingType                = std::underlying_type_t<Type>;
+
+        return AddSchemaFingerprintValue(AddSchemaFingerprintString(hash, std::is_signed_v<UnderlyingType> ? "enum" : "uenum"), sizeof(UnderlyingType));
+    }
+    else if constexpr(std::is_array_v<Type>)
+        return AddSchemaTypeFingerprint<std::remove_extent_t<Type>>(AddSchemaFingerprintValue(AddSchemaFingerprintString(hash, "array"), std::extent_v<Type>));
+    else if constexpr(std::is_pointer_v<Type> || IsSchemaPointer<Type>) {
+        using PointeeType                   = std::remove_cv_t<typename std::pointer_traits<Type>::element_type>;
+
+        hash = AddSchemaFingerprintString(hash, "pointer");
+
+        // Objects are described by name, as they may refer to the object that contains the pointer
+        if constexpr(has_SerializationPOD<PointeeType>)
+            return AddSchemaFingerprintString(hash, PointeeType::SerializationSchema::TypeName);
+        else
+            return AddSchemaTypeFingerprint<PointeeType>(hash);
+    }
+    else if constexpr(IsSchemaTupleLike<Type>)
+        return AddSchemaTupleFingerprint<Type>(
+            AddSchemaFingerprintValue(AddSchemaFingerprintString(hash, "tuple"), std::tuple_size<Type>::value),
+            std::make_index_sequence<std::tuple_size<Type>::value>()
+        );
+    else if constexpr(IsSchemaRange<Type> && IsSchemaMap<Type>)
+        return AddSchemaTypeFingerprint<typename Type::mapped_type>(AddSchemaTypeFingerprint<typename Type::key_type>(AddSchemaFingerprintString(hash, "map")));
+    else if constexpr(IsSchemaRange<Type> && IsSchemaSet<Type>)
+        return AddSchemaTypeFingerprint<typename Type::key_type>(AddSchemaFingerprintString(hash, "set"));
+    else if constexpr(IsSchemaRange<Type>)
+        return AddSchemaTypeFingerprint<typename Type::value_type>(AddSchemaFingerprintString(hash, "sequence"));
+    else if constexpr(IsSchemaOptional<Type>)
+        return AddSchemaTypeFingerprint<typename Type::value_type>(AddSchemaFingerprintString(hash, "optional"));
+    else
+        return AddSchemaFingerprintString(hash, "opaque");
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      ComputeSchemaFingerprint
+///  \brief         Implementation of GetSchemaFingerprint.
+///
+template <typename T>
+constexpr std::uint64_t ComputeSchemaFingerprint(void) {
+    using Schema                            = typename T::SerializationSchema;
+    using BaseTypes                         = typename Schema::BaseTypes;
+
+    std::uint64_t                           hash(SchemaFingerprintBasis);
+
+    hash = AddSchemaFingerprintString(hash, Schema::TypeName);
+    hash = AddSchemaFingerprintValue(hash, Schema::Version);
+    hash = AddSchemaFingerprintValue(hash, Schema::FormatFlags);
+
+    hash = AddSchemaFingerprintValue(hash, std::tuple_size_v<BaseTypes>);
+    hash = AddSchemaBaseFingerprints<BaseTypes>(hash, std::make_index_sequence<std::tuple_size_v<BaseTypes>>());
+
+    hash = AddSchemaFingerprintValue(hash, Schema::NumFields);
+
+    ForEachSchemaField<T>(
+        [&hash](auto const &field) {
+            hash = AddSchemaTypeFingerprint<typename std::decay_t<decltype(field)>::Type>(AddSchemaFingerprintString(hash, field.name));
+        }
+    );
+
+    return hash;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SerializedSizeStreambuf
+///  \brief         Streambuf that counts the characters written to it
+///                 without storing them.
+///
+class SerializedSizeStreambuf : public std::streambuf {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    size_t GetSize(void) const { return _size; }
+
+protected:
+    // ----------------------------------------------------------------------
+    // |  Protected Methods
+    int_type overflow(int_type c) override {
+        if(traits_type::eq_int_type(c, traits_type::eof()) == false)
+            ++_size;
+
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(char_type const *, std::streamsize count) override {
+        _size += static_cast<size_t>(count);
+        return count;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    size_t                                  _size = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetArchiveHeaderSize
+///  \brief         Returns the number of bytes written by ArchiveT before any
+///                 objects are serialized. The value is calculated once per
+///                 archive type.
+///
+template <typename ArchiveT>
+size_t GetArchiveHeaderSize(void) {
+    static size_t const                     size(
+        [](void) {
+            SerializedSizeStreambuf         buffer;
+            std::ostream                    out(&buffer);
+
+            { ArchiveT ar(out); }
+
+            return buffer.GetSize();
+        }()
+    );
+
+    return size;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetSerializedSize
+///  \brief         Implementation of the GetSerializedSize method generated
+///                 by SERIALIZATION. The size is calculated without serializing
+///                 the object when SerializedSizeUpperBound is known; the
+///                 object is serialized to a SerializedSizeStreambuf otherwise.
+///
+template <typename ArchiveT, typename T>
+size_t GetSerializedSize(T const &obj) {
+    if constexpr(T::template SerializedSizeUpperBound<ArchiveT> != UnboundedSerializedSize)
+        return GetArchiveHeaderSize<ArchiveT>() + T::template SerializedSizeUpperBound<ArchiveT>;
+    else {
+        SerializedSizeStreambuf             buffer;
+        std::ostream                        out(&buffer);
+
+        obj.template Serialize<ArchiveT>(out);
+        return buffer.GetSize();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetSerializedPtrSize
+///  \brief         Implementation of the GetSerializedPtrSize method generated
+///                 by SERIALIZATION.
+///
+template <typename ArchiveT, typename T>
+size_t GetSerializedPtrSize(T const &obj) {
+    SerializedSizeStreambuf                 buffer;
+    std::ostream                            out(&buffer);
+
+    obj.template SerializePtr<ArchiveT>(out);
+    return buffer.GetSize();
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         FixedBufferStreambuf
+///  \brief         Streambuf that reads from or writes to a caller-provided
+///                 buffer without allocating memory. Writes beyond the end of
+///                 the buffer fail.
+///
+class FixedBufferStreambuf : public std::streambuf {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    FixedBufferStreambuf(char *pBuffer, size_t cBuffer) {
+        setp(pBuffer, pBuffer + cBuffer);
+    }
+
+    FixedBufferStreambuf(char const *pBuffer, size_t cBuffer) {
+        // The get area is never written to
+        char * const                        ptr(const_cast<char *>(pBuffer));
+
+        setg(ptr, ptr, ptr + cBuffer);
+    }
+
+    size_t GetNumBytesWritten(void) const { return static_cast<size_t>(pptr() - pbase()); }
+    bool IsFull(void) const { return pptr() == epptr(); }
+
+protected:
+    // ----------------------------------------------------------------------
+    // |  Protected Methods
+
+    // Seeking is only supported when reading
+    pos_type seekoff(off_type offset, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if(eback() == nullptr || (which & std::ios_base::in) == 0)
+            return pos_type(off_type(-1));
+
+        off_type                            base(0);
+
+        if(dir == std::ios_base::cur)
+            base = gptr() - eback();
+        else if(dir == std::ios_base::end)
+            base = egptr() - eback();
+
+        return seekpos(pos_type(base + offset), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        off_type const                      offset(pos);
+
+        if(eback() == nullptr || (which & std::ios_base::in) == 0 || offset < 0 || offset > egptr() - eback())
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + offset, egptr());
+        return pos;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SerializeToBuffer
+///  \brief         Implementation of the Serialize method generated by
+///                 SERIALIZATION that writes to a caller-provided buffer;
+///                 returns the number of bytes written. std::length_error is
+///                 thrown if the buffer is too small.
+///
+template <typename ArchiveT, typename T>
+size_t SerializeToBuffer(T const &obj, void *pBuffer, size_t cBuffer) {
+    FixedBufferStreambuf                    buffer(static_cast<char *>(pBuffer), cBuffer);
+    std::ostream                            out(&buffer);
+
+    try {
+        obj.template Serialize<ArchiveT>(out);
+    }
+    catch(boost::archive::archive_exception const &ex) {
+        // Archives report a full buffer as an output stream error
+        if(ex.code == boost::archive::archive_exception::output_stream_error && (!out || buffer.IsFull()))
+            throw std::length_error("The buffer is too small for the serialized data");
+
+        throw;
+    }
+
+    // Some archives write content when they are destroyed, so check the
+    // stream state once the archive is no longer in scope.
+    if(!out)
+        throw std::length_error("The buffer is too small for the serialized data");
+
+    return buffer.GetNumBytesWritten();
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeserializeFromBuffer
+///  \brief         Implementation of the Deserialize method generated by
+///                 SERIALIZATION that reads from a caller-provided buffer.
+///
+template <typename ArchiveT, typename T>
+T DeserializeFromBuffer(void const *pBuffer, size_t cBuffer) {
+    FixedBufferStreambuf                    buffer(static_cast<char const *>(pBuffer), cBuffer);
+    std::istream                            in(&buffer);
+
+    return T::template Deserialize<ArchiveT>(in);
+}
+
+#if (defined __cpp_lib_memory_resource)
+
+class DeserializationMemoryResourceScope;
+
+/// Stored before each SerializationPOD allocation so that the object can be
+/// released after the DeserializationMemoryResourceScope has ended.
+struct SerializationPODAllocationHeader {
+    std::pmr::memory_resource *             pResource;
+    size_t                                  cBytes;
+
+    // Links used by the scope that the allocation was made in while the scope is active
+    DeserializationMemoryResourceScope *    pScope;
+    SerializationPODAllocationHeader *      pPrev;
+    SerializationPODAllocationHeader *      pNext;
+
+    // Set once the SerializationPOD has been constructed in the allocation (see
+    // OnSerializationPODConstructed), so that it can be destroyed if deserialization throws
+    bool                                    constructed;
+    void *                                  pObj;
+    void (*                                 pDestroy)(void *) noexcept;
+};
+
+constexpr size_t const SerializationPODAllocationHeaderSize = (sizeof(SerializationPODAllocationHeader) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DeserializationMemoryResourceScope
+///  \brief         Sets the memory resource used to allocate polymorphic
+///                 SerializationPOD objects on the current thread for the
+///                 lifetime of the object; std::pmr::new_delete_resource is
+///                 used when a scope isn't active.
+///
+///                 The scope tracks the allocations made while it is active,
+///                 so that they can be returned to the resource when
+///                 deserialization throws (see ReleaseAllocations).
+///
+class DeserializationMemoryResourceScope {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    explicit DeserializationMemoryResourceScope(std::pmr::memory_resource &resource) :
+        _resource(resource),
+        _pPrevious(GetCurrent()),
+        _pAllocations(nullptr),
+        _pOldestAllocation(nullptr),
+        _pLastAllocation(nullptr)
+    {
+        GetCurrent() = this;
+    }
+
+    ~DeserializationMemoryResourceScope(void) {
+        // Allocations that outlive the scope are released by DeallocateSerializationPOD
+        while(_pAllocations)
+            Untrack(*_pAllocations);
+
+        GetCurrent() = _pPrevious;
+    }
+
+    DeserializationMemoryResourceScope(DeserializationMemoryResourceScope const &) = delete;
+    DeserializationMemoryResourceScope & operator =(DeserializationMemoryResourceScope const &) = delete;
+
+    static DeserializationMemoryResourceScope * GetActive(void) {
+        return GetCurrent();
+    }
+
+    std::pmr::memory_resource & GetResource(void) const {
+        return _resource;
+    }
+
+    void Track(SerializationPODAllocationHeader &header) {
+        header.pScope = this;
+        header.pPrev = nullptr;
+        header.pNext = _pAllocations;
+
+        if(_pAllocations)
+            _pAllocations->pPrev = &header;
+        else
+            _pOldestAllocation = &header;
+
+        _pAllocations = &header;
+        _pLastAllocation = &header;
+    }
+
+    void Untrack(SerializationPODAllocationHeader &header) noexcept {
+        if(header.pPrev)
+            header.pPrev->pNext = header.pNext;
+        else
+            _pAllocations = header.pNext;
+
+        if(header.pNext)
+            header.pNext->pPrev = header.pPrev;
+        else
+            _pOldestAllocation = header.pPrev;
+
+        if(_pLastAllocation == &header)
+            _pLastAllocation = nullptr;
+
+        header.pScope = nullptr;
+        header.pPrev = nullptr;
+        header.pNext = nullptr;
+    }
+
+    /// Marks the most recent allocation as constructed when pObj (the
+    /// SerializationPOD being constructed, or one of its base classes) lies
+    /// within it.
+    void OnConstructed(void *pObj, void (*pDestroy)(void *) noexcept) noexcept {
+        if(_pLastAllocation == nullptr)
+            return;
+
+        char const * const                  pBegin(reinterpret_cast<char const *>(_pLastAllocation) + SerializationPODAllocationHeaderSize);
+        char const * const                  pEnd(reinterpret_cast<char const *>(_pLastAllocation) + _pLastAllocation->cBytes);
+        char const * const                  pValue(static_cast<char const *>(pObj));
+
+        if(std::less<char const *>()(pValue, pBegin) || std::less<char const *>()(pValue, pEnd) == false)
+            return;
+
+        _pLastAllocation->constructed = true;
+        _pLastAllocation->pObj = pObj;
+        _pLastAllocation->pDestroy = pDestroy;
+    }
+
+    /// Destroys the objects in all allocations made within the scope that are
+    /// still outstanding (if they were constructed) and returns their memory
+    /// to the resource. Boost doesn't release an object that it was loading
+    /// through a pointer when the load throws, so this is invoked when
+    /// DeserializePtr fails. Allocations are released from oldest to newest,
+    /// as destroying an object releases the objects that it owns (which
+    /// were allocated after it).
+    void ReleaseAllocations(void) noexcept {
+        while(_pOldestAllocation) {
+            SerializationPODAllocationHeader &              header(*_pOldestAllocation);
+
+            if(header.constructed) {
+                header.constructed = false;
+                header.pDestroy(header.pObj);
+            }
+
+            Untrack(header);
+            _resource.deallocate(&header, header.cBytes, alignof(std::max_align_t));
+        }
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::pmr::memory_resource &             _resource;
+    DeserializationMemoryResourceScope * const          _pPrevious;
+    SerializationPODAllocationHeader *      _pAllocations;
+    SerializationPODAllocationHeader *      _pOldestAllocation;
+    SerializationPODAllocationHeader *      _pLastAllocation;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    static DeserializationMemoryResourceScope *& GetCurrent(void) {
+        thread_local DeserializationMemoryResourceScope *                   pScope(nullptr);
+
+        return pScope;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      AllocateSerializationPOD
+///  \brief         Implementation of operator new for polymorphic
+///                 SerializationPOD objects.
+///
+inline void * AllocateSerializationPOD(size_t cBytes) {
+    DeserializationMemoryResourceScope * const          pScope(DeserializationMemoryResourceScope::GetActive());
+    std::pmr::memory_resource &             resource(pScope ? pScope->GetResource() : *std::pmr::new_delete_resource());
+
+    cBytes += SerializationPODAllocationHeaderSize;
+
+    char * const                            pMemory(static_cast<char *>(resource.allocate(cBytes, alignof(std::max_align_t))));
+    SerializationPODAllocationHeader * const            pHeader(new (pMemory) SerializationPODAllocationHeader{ &resource, cBytes, nullptr, nullptr, nullptr, false, nullptr, nullptr });
+
+    if(pScope)
+        pScope->Track(*pHeader);
+
+    return pMemory + SerializationPODAllocationHeaderSize;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeallocateSerializationPOD
+///  \brief         Implementation of operator delete for polymorphic
+///                 SerializationPOD objects.
+///
+inline void DeallocateSerializationPOD(void *pObj) noexcept {
+    if(pObj == nullptr)
+        return;
+
+    char * const                            pMemory(static_cast<char *>(pObj) - SerializationPODAllocationHeaderSize);
+    SerializationPODAllocationHeader &      header(*reinterpret_cast<SerializationPODAllocationHeader *>(pMemory));
+
+    if(header.pScope)
+        header.pScope->Untrack(header);
+
+    header.pResource->deallocate(pMemory, header.cBytes, alignof(std::max_align_t));
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      OnSerializationPODConstructed
+///  \brief         Invoked by the constructors of polymorphic SerializationPOD
+///                 objects so that an object allocated within a
+///                 DeserializationMemoryResourceScope is destroyed if
+///                 deserialization throws (see ReleaseAllocations). The
+///                 most derived constructor runs last, so T is the type of
+///                 the complete object.
+///
+template <typename T>
+void OnSerializationPODConstructed(T &obj) noexcept {
+    DeserializationMemoryResourceScope * const          pScope(DeserializationMemoryResourceScope::GetActive());
+
+    if(pScope)
+        pScope->OnConstructed(&obj, [](void *pObj) noexcept { static_cast<T *>(pObj)->~T(); });
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      ConstructArenaPtr
+///  \brief         Constructs an object of type T in memory allocated from
+///                 the resource.
+///
+template <typename T, typename BaseT, typename... ArgTs>
+ArenaUniquePtr<BaseT> ConstructArenaPtr(std::pmr::memory_resource &resource, ArgTs &&... args) {
+    void * const                            pMemory(resource.allocate(sizeof(T), alignof(T)));
+    T *                                     pObj;
+
+    try {
+        pObj = new (pMemory) T(std::forward<ArgTs>(args)...);
+    }
+    catch(...) {
+        resource.deallocate(pMemory, sizeof(T), alignof(T));
+        throw;
+    }
+
+    return ArenaUniquePtr<BaseT>(pObj, ArenaDeleter<BaseT>(resource, sizeof(T), alignof(T)));
+}
+
+#endif
+
 /////////////////////////////////////////////////////////////////////////
 ///  \function      ScrubSerializationName
 ///  \brief         The name used when serializing name-value pairs must be
@@ -1091,8 +3572,10 @@ using DeserializeDataType                   = typename Details::DeserializeDataT
 ///                 may have punctuation chars (for example when the name is
 ///                 part of a namespace). This method will return the first
 ///                 alphanumeric char after the last non-alphanumeric char.
+///                 The generated code evaluates it at compile time, as the
+///                 names are string literals.
 ///
-inline char const * ScrubSerializationName(char const *name) {
+constexpr char const * ScrubSerializationName(char const *name) {
     char const *                            pLastInvalid(nullptr);
     char const *                            ptr(name);
 
@@ -69,13 +69,21 @@ constexpr bool const HasStandardSerializationMethods = HasSerializationPOD<T>;
 template <typename T>
 constexpr bool const HasPolymorphicSerializationMethods = std::is_same_v<std::true_type, decltype(Details::HasPolymorphicSerializationMethodsImpl<T>(nullptr))>;
 
+template <typename T>
+constexpr bool const HasBitwiseSerializationPOD = HasSerializationPOD<T> && boost::serialization::is_bitwise_serializable<T>::value;
+
 struct SerializationTag_PODBased {};  ///< Object is POD-based and should be serialized via standard methods
+struct SerializationTag_PODBitwise {};  ///< Object is POD-based and declared via SERIALIZATION_BITWISE_DECLARE
 struct SerializationTag_Standard {};  ///< Object is not POD-based.
 
 template <typename T>
 using GetSerializationTag = std::conditional_t<
     HasSerializationPOD<T>,
-    SerializationTag_PODBased,
+    std::conditional_t<
+        HasBitwiseSerializationPOD<T>,
+        SerializationTag_PODBitwise,
+        SerializationTag_PODBased
+    >,
     SerializationTag_Standard
 >;
 
@@ -107,6 +115,32 @@ void serialize_impl(
     // Nothing to do here, as the serialization is handled by save_construct_data and load_construct_data
 }
 
+// Bitwise serializable objects are default constructible, which means that boost will default
+// construct them when loading collections rather than invoking load_construct_data. Because
+// of this, the data is serialized here and the construct data is empty.
+template <typename ArchiveT, typename T>
+void serialize_impl(
+    ArchiveT &ar,
+    T &t,
+    version_type,
+    BoostHelpers::Serialization::Details::PODBasedSerialization::SerializationTag_PODBitwise
+) {
+    if constexpr(ArchiveT::is_saving::value) {
+        typename T::SerializationPOD::SerializeData const   data(t);
+
+        BoostHelpers::Serialization::Details::SaveNamed(ar, "data", data);
+    }
+    else {
+        typename T::SerializationPOD::DeserializeData       data;
+
+        BoostHelpers::Serialization::Details::LoadNamed(ar, "data", data);
+
+        // Trivially copyable objects have trivial destructors, so there is no need to destroy
+        // the existing object before constructing the new one in its place.
+        ::new(&t) T(std::move(data));
+    }
+}
+
 template <typename ArchiveT, typename T>
 void serialize_impl(
     ArchiveT &ar,
@@ -142,9 +176,19 @@ void save_construct_data_impl(
     version_type,
     BoostHelpers::Serialization::Details::PODBasedSerialization::SerializationTag_PODBased
 ) {
-    typename T::SerializationPOD            pod(*t);
+    typename T::SerializationPOD::SerializeData const       data(*t);
+
+    BoostHelpers::Serialization::Details::SaveNamed(ar, "data", data);
+}
 
-    ar << boost::serialization::make_nvp("data", pod);
+template <typename ArchiveT, typename T>
+void save_construct_data_impl(
+    ArchiveT &,
+    T const *,
+    version_type,
+    BoostHelpers::Serialization::Details::PODBasedSerialization::SerializationTag_PODBitwise
+) {
+    // Nothing to do here, as the serialization is handled by serialize_impl
 }
 
 template <typename ArchiveT, typename T>
@@ -164,10 +208,20 @@ void load_construct_data_impl(
     version_type,
     BoostHelpers::Serialization::Details::PODBasedSerialization::SerializationTag_PODBased
 ) {
-    typename T::SerializationPOD            pod;
+    typename T::SerializationPOD::DeserializeData           data;
+
+    BoostHelpers::Serialization::Details::LoadNamed(ar, "data", data);
+    ::new(t) T(std::move(data));
+}
 
-    ar >> boost::serialization::make_nvp("data", pod);
-    ::new(t) T(pod.Construct());
+template <typename ArchiveT, typename T>
+void load_construct_data_impl(
+    ArchiveT &,
+    T *t,
+    version_type,
+    BoostHelpers::Serialization::Details::PODBasedSerialization::SerializationTag_PODBitwise
+) {
+    ::new(t) T();
 }
 
 template <typename ArchiveT, typename T>
@@ -0,0 +1,348 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SerializationStats.h
+///  \brief         Contains the GetSerializationStats and ResetSerializationStats
+///                 functions
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-15 11:03:52
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <ios>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          SerializationOperation
+///  \brief         The generated methods that record statistics when
+///                 SERIALIZATION_STATS is defined.
+///
+enum class SerializationOperation {
+    Serialize,
+    Deserialize,
+    SerializePtr,
+    DeserializePtr
+};
+
+constexpr size_t const NumSerializationOperations = 4;
+
+/// Number of buckets in SerializationOperationStats::latencyHistogram. Bucket N
+/// counts calls that took less than 2^(N + 1) nanoseconds (and at least 2^N
+/// nanoseconds, for N > 0); the last bucket counts all calls that took longer.
+constexpr size_t const NumSerializationLatencyBuckets = 40;
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SerializationOperationStats
+///  \brief         Statistics for one operation of a type.
+///
+struct SerializationOperationStats {
+    std::uint64_t                           calls;
+    std::uint64_t                           totalNanoseconds;
+    std::array<std::uint64_t, NumSerializationLatencyBuckets>               latencyHistogram;
+
+    /// Bytes written or read by the overloads that create the archive from a
+    /// stream or stream buffer (the overloads that take an archive can't
+    /// determine the number of bytes), along with the number of calls that
+    /// contributed to the value.
+    std::uint64_t                           bytes;
+    std::uint64_t                           bytesCalls;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SerializationTypeStats
+///  \brief         Statistics for a type generated by SERIALIZATION.
+///
+struct SerializationTypeStats {
+    std::string                             name;
+    std::array<SerializationOperationStats, NumSerializationOperations>     operations;
+
+    SerializationOperationStats const & Get(SerializationOperation operation) const {
+        return operations[static_cast<size_t>(operation)];
+    }
+};
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SerializationStatsCounters
+///  \brief         The counters updated for a type; values are updated with
+///                 relaxed atomics, so a snapshot taken while calls are in
+///                 progress may not be consistent across counters.
+///
+class SerializationStatsCounters {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    SerializationStatsCounters(char const *name) :
+        _name(name)
+    {
+        Reset();
+    }
+
+    void RecordCall(SerializationOperation operation, std::uint64_t nanoseconds) {
+        Counters &                          counters(_counters[static_cast<size_t>(operation)]);
+
+        counters.calls.fetch_add(1, std::memory_order_relaxed);
+        counters.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        counters.latencyHistogram[GetLatencyBucket(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RecordBytes(SerializationOperation operation, std::uint64_t bytes) {
+        Counters &                          counters(_counters[static_cast<size_t>(operation)]);
+
+        counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        counters.bytesCalls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    SerializationTypeStats GetStats(void) const {
+        SerializationTypeStats              result;
+
+        result.name = _name;
+
+        for(size_t operationIndex = 0; operationIndex < NumSerializationOperations; ++operationIndex) {
+            Counters const &                counters(_counters[operationIndex]);
+            SerializationOperationStats &   stats(result.operations[operationIndex]);
+
+            stats.calls = counters.calls.load(std::memory_order_relaxed);
+            stats.totalNanoseconds = counters.totalNanoseconds.load(std::memory_order_relaxed);
+            stats.bytes = counters.bytes.load(std::memory_order_relaxed);
+            stats.bytesCalls = counters.bytesCalls.load(std::memory_order_relaxed);
+
+            for(size_t bucketIndex = 0; bucketIndex < NumSerializationLatencyBuckets; ++bucketIndex)
+                stats.latencyHistogram[bucketIndex] = counters.latencyHistogram[bucketIndex].load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    void Reset(void) {
+        for(Counters &counters : _counters) {
+            counters.calls.store(0, std::memory_order_relaxed);
+            counters.totalNanoseconds.store(0, std::memory_order_relaxed);
+            counters.bytes.store(0, std::memory_order_relaxed);
+            counters.bytesCalls.store(0, std::memory_order_relaxed);
+
+            for(std::atomic<std::uint64_t> &bucket : counters.latencyHistogram)
+                bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static size_t GetLatencyBucket(std::uint64_t nanoseconds) {
+        size_t                              bucket(0);
+
+        while(nanoseconds > 1 && bucket + 1 < NumSerializationLatencyBuckets) {
+            nanoseconds >>= 1;
+            ++bucket;
+        }
+
+        return bucket;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    struct Counters {
+        std::atomic<std::uint64_t>          calls;
+        std::atomic<std::uint64_t>          totalNanoseconds;
+        std::atomic<std::uint64_t>          bytes;
+        std::atomic<std::uint64_t>          bytesCalls;
+        std::array<std::atomic<std::uint64_t>, NumSerializationLatencyBuckets>  latencyHistogram;
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::string const                       _name;
+    std::array<Counters, NumSerializationOperations>                        _counters;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SerializationStatsRegistry
+///  \brief         The counters for all types that have been serialized or
+///                 deserialized. Types are registered the first time that
+///                 they are used.
+///
+class SerializationStatsRegistry {
+public:
+    static SerializationStatsRegistry & Get(void) {
+        static SerializationStatsRegistry   registry;
+
+        return registry;
+    }
+
+    SerializationStatsCounters & Register(char const *name) {
+        std::lock_guard<std::mutex> const   lock(_mutex);
+
+        // std::deque doesn't move existing elements when new elements are added at the end
+        return _counters.emplace_back(name);
+    }
+
+    std::vector<SerializationTypeStats> GetStats(void) const {
+        std::lock_guard<std::mutex> const   lock(_mutex);
+        std::vector<SerializationTypeStats> results;
+
+        results.reserve(_counters.size());
+
+        for(SerializationStatsCounters const &counters : _counters)
+            results.emplace_back(counters.GetStats());
+
+        return results;
+    }
+
+    void Reset(void) {
+        std::lock_guard<std::mutex> const   lock(_mutex);
+
+        for(SerializationStatsCounters &counters : _counters)
+            counters.Reset();
+    }
+
+private:
+    mutable std::mutex                      _mutex;
+    std::deque<SerializationStatsCounters>  _counters;
+
+    SerializationStatsRegistry(void) = default;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetSerializationStatsCounters
+///  \brief         Returns the counters for T, registering them on first use.
+///
+template <typename T>
+SerializationStatsCounters & GetSerializationStatsCounters(char const *name) {
+    static SerializationStatsCounters &     counters(SerializationStatsRegistry::Get().Register(name));
+
+    return counters;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SerializationStatsCallScope
+///  \brief         Records a call and its latency when the scope ends.
+///
+class SerializationStatsCallScope {
+public:
+    SerializationStatsCallScope(SerializationStatsCounters &counters, SerializationOperation operation) :
+        _counters(counters),
+        _operation(operation),
+        _start(std::chrono::steady_clock::now())
+    {}
+
+    ~SerializationStatsCallScope(void) {
+        _counters.RecordCall(
+            _operation,
+            static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count())
+        );
+    }
+
+    SerializationStatsCallScope(SerializationStatsCallScope const &) = delete;
+    SerializationStatsCallScope & operator =(SerializationStatsCallScope const &) = delete;
+
+private:
+    SerializationStatsCounters &            _counters;
+    SerializationOperation const            _operation;
+    std::chrono::steady_clock::time_point const                             _start;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SerializationStatsBytesScope
+///  \brief         Records the number of bytes written to or read from a
+///                 stream buffer when the scope ends. Nothing is recorded
+///                 when the stream buffer doesn't report its position.
+///
+template <typename CharT, typename TraitsT>
+class SerializationStatsBytesScope {
+public:
+    SerializationStatsBytesScope(SerializationStatsCounters &counters, SerializationOperation operation, std::basic_streambuf<CharT, TraitsT> &buffer) :
+        _counters(counters),
+        _operation(operation),
+        _mode(operation == SerializationOperation::Serialize || operation == SerializationOperation::SerializePtr ? std::ios_base::out : std::ios_base::in),
+        _pBuffer(&buffer),
+        _start(GetPosition(buffer, _mode))
+    {}
+
+    SerializationStatsBytesScope(SerializationStatsCounters &counters, SerializationOperation operation, std::basic_ios<CharT, TraitsT> &s) :
+        SerializationStatsBytesScope(counters, operation, *s.rdbuf())
+    {}
+
+    ~SerializationStatsBytesScope(void) {
+        if(IsValidPosition(_start) == false)
+            return;
+
+        typename TraitsT::pos_type const    end(GetPosition(*_pBuffer, _mode));
+
+        if(IsValidPosition(end) == false)
+            return;
+
+        typename TraitsT::off_type const    delta(end - _start);
+
+        if(delta >= 0)
+            _counters.RecordBytes(_operation, static_cast<std::uint64_t>(delta) * sizeof(CharT));
+    }
+
+    SerializationStatsBytesScope(SerializationStatsBytesScope const &) = delete;
+    SerializationStatsBytesScope & operator =(SerializationStatsBytesScope const &) = delete;
+
+private:
+    SerializationStatsCounters &            _counters;
+    SerializationOperation const            _operation;
+    std::ios_base::openmode const           _mode;
+    std::basic_streambuf<CharT, TraitsT> * const                            _pBuffer;
+    typename TraitsT::pos_type const        _start;
+
+    static typename TraitsT::pos_type GetPosition(std::basic_streambuf<CharT, TraitsT> &buffer, std::ios_base::openmode mode) {
+        return buffer.pubseekoff(0, std::ios_base::cur, mode);
+    }
+
+    static bool IsValidPosition(typename TraitsT::pos_type const &position) {
+        return position != typename TraitsT::pos_type(typename TraitsT::off_type(-1));
+    }
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      GetSerializationStats
+///  \brief         Returns a snapshot of the statistics recorded for each type
+///                 that has been serialized or deserialized since the process
+///                 started (see SERIALIZATION_STATS). Types are named by the
+///                 name provided to SERIALIZATION, so different types with
+///                 the same name in different namespaces have different
+///                 entries with the same name.
+///
+inline std::vector<SerializationTypeStats> GetSerializationStats(void) {
+    return Details::SerializationStatsRegistry::Get().GetStats();
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      ResetSerializationStats
+///  \brief         Resets all of the statistics to 0.
+///
+inline void ResetSerializationStats(void) {
+    Details::SerializationStatsRegistry::Get().Reset();
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
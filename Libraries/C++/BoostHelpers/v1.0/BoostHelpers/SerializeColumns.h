@@ -0,0 +1,343 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SerializeColumns.h
+///  \brief         Contains the SerializeColumns and DeserializeColumns functions
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 21:12:37
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/Serialization.h>
+
+#include <boost/serialization/collection_size_type.hpp>
+
+#include <algorithm>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+namespace Details {
+
+template <typename T>
+constexpr bool const IsColumnElementImpl = has_SerializationPOD<T> && CommonHelpers::TypeTraits::IsSmartPointer<T> == false;
+
+template <typename T>
+constexpr bool CheckColumnElement(void) {
+    static_assert(IsColumnElementImpl<T>, "Columns are only available for types generated by SERIALIZATION");
+    static_assert(T::SerializationSchema::IsCustom == false, "Columns are not available for types declared with SERIALIZATION_DATA_CUSTOM_TYPES");
+    static_assert(std::tuple_size_v<typename T::SerializationSchema::BaseTypes> == 0, "Columns are not available for types declared with BASES");
+
+    return true;
+}
+
+/// The type of the values stored in a column while it is being deserialized
+template <typename FieldT>
+using ColumnValueType                       = DeserializeDataType<typename FieldT::Type>;
+
+/// Columns are written with a single save_binary/load_binary call when the
+/// archive writes raw bytes and the member is trivially copyable.
+template <typename ArchiveT, typename FieldT>
+constexpr bool const IsBulkColumn =
+    IsBitwiseArchive<ArchiveT>
+    && has_SerializationPOD<typename FieldT::Type> == false
+    && IsBitwiseMember<typename FieldT::Type>;
+
+template <typename T>
+using SchemaFieldType                       = std::remove_const_t<std::remove_reference_t<T>>;
+
+template <size_t Index, typename T>
+using SchemaFieldAt                         = SchemaFieldType<decltype(std::get<Index>(T::SerializationSchema::GetFields()))>;
+
+template <typename ArchiveT>
+size_t DeserializeColumnsCount(ArchiveT &ar) {
+    boost::serialization::collection_size_type          count;
+
+    LoadNamed(ar, "count", count);
+    return static_cast<size_t>(count);
+}
+
+template <typename ArchiveT, typename FieldT, typename ForwardIteratorT>
+void SaveColumn(ArchiveT &ar, FieldT const &field, ForwardIteratorT first, ForwardIteratorT last) {
+    using Type                              = typename FieldT::Type;
+
+    if constexpr(IsBulkColumn<ArchiveT, FieldT>) {
+        std::vector<Type>                   values;
+
+        values.reserve(static_cast<size_t>(std::distance(first, last)));
+
+        while(first != last) {
+            values.emplace_back(field.Get(*first));
+            ++first;
+        }
+
+        if(values.empty() == false)
+            ar.save_binary(values.data(), values.size() * sizeof(Type));
+    }
+    else {
+        while(first != last) {
+            std::add_const_t<SerializeDataType<Type>>       value(field.Get(*first));
+
+            SaveNamed(ar, field.name, value);
+            ++first;
+        }
+    }
+}
+
+template <typename ArchiveT, typename FieldT>
+std::vector<ColumnValueType<FieldT>> LoadColumn(ArchiveT &ar, FieldT const &field, size_t count) {
+    std::vector<ColumnValueType<FieldT>>    values;
+
+    if constexpr(IsBulkColumn<ArchiveT, FieldT>) {
+        values.resize(count);
+
+        if(count)
+            ar.load_binary(values.data(), count * sizeof(ColumnValueType<FieldT>));
+    }
+    else {
+        values.reserve(count);
+
+        while(count--) {
+            ColumnValueType<FieldT>         value;
+
+            LoadNamed(ar, field.name, value);
+            values.emplace_back(std::move(value));
+        }
+    }
+
+    return values;
+}
+
+template <typename ArchiveT, typename FieldT>
+void SkipColumn(ArchiveT &ar, FieldT const &field, size_t count) {
+    if constexpr(IsBulkColumn<ArchiveT, FieldT>) {
+        // The data must still be read from the archive, but it doesn't need
+        // to be decoded.
+        unsigned char                       buffer[4096];
+        size_t                              cRemaining(count * sizeof(ColumnValueType<FieldT>));
+
+        while(cRemaining) {
+            size_t const                    cBytes(std::min(cRemaining, sizeof(buffer)));
+
+            ar.load_binary(buffer, cBytes);
+            cRemaining -= cBytes;
+        }
+    }
+    else {
+        while(count--) {
+            ColumnValueType<FieldT>         value;
+
+            LoadNamed(ar, field.name, value);
+        }
+    }
+}
+
+template <typename FieldT>
+std::vector<typename FieldT::Type> CreateColumn(std::vector<ColumnValueType<FieldT>> &&values) {
+    using Type                              = typename FieldT::Type;
+
+    if constexpr(std::is_same_v<ColumnValueType<FieldT>, Type>)
+        return std::move(values);
+    else {
+        std::vector<Type>                   result;
+
+        result.reserve(values.size());
+
+        for(auto &value : values)
+            result.emplace_back(CreateMember<Type>(std::move(value)));
+
+        return result;
+    }
+}
+
+template <typename T, typename ColumnsT, size_t... Indexes>
+void AssignColumnValues(typename T::SerializationPOD::DeserializeLocalData &local, ColumnsT &columns, size_t index, std::index_sequence<Indexes...>) {
+    constexpr auto                          fields(T::SerializationSchema::GetFields());
+
+    UNUSED(local);
+    UNUSED(columns);
+    UNUSED(index);
+
+    ((local.*std::get<Indexes>(fields).deserializePointer = std::move(std::get<Indexes>(columns)[index])), ...);
+}
+
+template <typename ArchiveT, typename T, size_t... Indexes>
+auto LoadColumns(ArchiveT &ar, size_t count, std::index_sequence<Indexes...>) {
+    constexpr auto                          fields(T::SerializationSchema::GetFields());
+
+    UNUSED(ar);
+    UNUSED(count);
+
+    // Braced initialization ensures that the columns are read in order
+    return std::tuple<std::vector<ColumnValueType<SchemaFieldAt<Indexes, T>>>...>{ LoadColumn(ar, std::get<Indexes>(fields), count)... };
+}
+
+template <size_t Index, size_t... Indexes>
+constexpr bool const IsRequestedColumn = ((Index == Indexes) || ...);
+
+template <size_t Index, size_t... Indexes>
+constexpr size_t const RequestedColumnPosition = [](void) {
+    size_t                                  result(0);
+
+    (void)((Index == Indexes ? true : (++result, false)) || ...);
+    return result;
+}();
+
+template <typename ArchiveT, typename T, size_t Index, size_t... RequestedIndexes, typename ColumnsT>
+void LoadRequestedColumn(ArchiveT &ar, size_t count, ColumnsT &columns) {
+    constexpr auto                          field(std::get<Index>(T::SerializationSchema::GetFields()));
+
+    if constexpr(IsRequestedColumn<Index, RequestedIndexes...>)
+        std::get<RequestedColumnPosition<Index, RequestedIndexes...>>(columns) = CreateColumn<SchemaFieldAt<Index, T>>(LoadColumn(ar, field, count));
+    else
+        SkipColumn(ar, field, count);
+}
+
+template <typename ArchiveT, typename T, size_t... RequestedIndexes, typename ColumnsT, size_t... Indexes>
+void LoadRequestedColumns(ArchiveT &ar, size_t count, ColumnsT &columns, std::index_sequence<Indexes...>) {
+    UNUSED(ar);
+    UNUSED(count);
+    UNUSED(columns);
+
+    (LoadRequestedColumn<ArchiveT, T, Indexes, RequestedIndexes...>(ar, count, columns), ...);
+}
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SerializeColumns
+///  \brief         Serializes a range of objects generated by SERIALIZATION as
+///                 columns: the number of elements is written once, followed by
+///                 the values of each member (in the order provided to MEMBERS)
+///                 for all of the elements. Columns of trivially copyable members
+///                 are written via a single memory copy with archives that write
+///                 raw bytes (e.g. boost::archive::binary_oarchive).
+///
+///                 Columns are only available for types that don't have BASES
+///                 and weren't declared with SERIALIZATION_DATA_CUSTOM_TYPES, as
+///                 the columns are created from the type's SerializationSchema.
+///
+///                 Example:
+///                     std::vector<Trade> const                            trades(...);
+///
+///                     SerializeColumns(ar, trades.begin(), trades.end());
+///
+///                     // ...
+///
+///                     std::vector<Trade>                                  new_trades;
+///
+///                     DeserializeColumns<boost::archive::binary_iarchive, Trade>(in_ar, new_trades);
+///
+///                     // Or, to load a subset of the columns:
+///                     auto [prices, symbols] = DeserializeColumns<
+///                         Trade,
+///                         GetSchemaFieldIndex<Trade>("price"),
+///                         GetSchemaFieldIndex<Trade>("symbol")
+///                     >(in_ar);                                           // std::tuple<std::vector<double>, std::vector<std::string>>
+///
+template <typename ArchiveT, typename ForwardIteratorT>
+ArchiveT & SerializeColumns(ArchiveT &ar, ForwardIteratorT first, ForwardIteratorT last) {
+    using T                                 = typename std::iterator_traits<ForwardIteratorT>::value_type;
+
+    static_assert(Details::CheckColumnElement<T>());
+
+    boost::serialization::collection_size_type const    count(static_cast<size_t>(std::distance(first, last)));
+
+    Details::SaveNamed(ar, "count", count);
+
+    ForEachSchemaField<T>(
+        [&ar, &first, &last](auto const &field) {
+            Details::SaveColumn(ar, field, first, last);
+        }
+    );
+
+    return ar;
+}
+
+template <typename ArchiveT, typename ForwardIteratorT, typename CharT, typename TraitsT>
+std::basic_ostream<CharT, TraitsT> & SerializeColumns(std::basic_ostream<CharT, TraitsT> &s, ForwardIteratorT first, ForwardIteratorT last) {
+    ArchiveT                                ar(s);
+
+    SerializeColumns(ar, first, last);
+    return s;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeserializeColumns
+///  \brief         Deserializes objects written by SerializeColumns, appending
+///                 them to the vector.
+///
+template <typename ArchiveT, typename T, typename AllocatorT>
+std::vector<T, AllocatorT> & DeserializeColumns(ArchiveT &ar, std::vector<T, AllocatorT> &items) {
+    static_assert(Details::CheckColumnElement<T>());
+
+    using Indexes                           = std::make_index_sequence<T::SerializationSchema::NumFields>;
+
+    size_t const                            count(Details::DeserializeColumnsCount(ar));
+    auto                                    columns(Details::LoadColumns<ArchiveT, T>(ar, count, Indexes()));
+
+    items.reserve(items.size() + count);
+
+    for(size_t index = 0; index < count; ++index) {
+        typename T::SerializationPOD::DeserializeData       data;
+
+        Details::AssignColumnValues<T>(data.local, columns, index, Indexes());
+        items.emplace_back(std::move(data));
+    }
+
+    return items;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeserializeColumns
+///  \brief         Deserializes a subset of the columns written by SerializeColumns,
+///                 where Indexes are the indexes of the requested fields in the
+///                 type's SerializationSchema (see GetSchemaFieldIndex). Returns a
+///                 tuple with a std::vector of values for each requested column,
+///                 in the order in which they were requested.
+///
+///                 Columns that weren't requested are read from the archive but
+///                 not decoded (when written via a single memory copy) or
+///                 discarded.
+///
+template <typename T, size_t... Indexes, typename ArchiveT>
+std::tuple<std::vector<typename Details::SchemaFieldAt<Indexes, T>::Type>...> DeserializeColumns(ArchiveT &ar) {
+    static_assert(Details::CheckColumnElement<T>());
+    static_assert(((Indexes < T::SerializationSchema::NumFields) && ...), "Invalid field index (see GetSchemaFieldIndex)");
+
+    std::tuple<std::vector<typename Details::SchemaFieldAt<Indexes, T>::Type>...>      columns;
+    size_t const                            count(Details::DeserializeColumnsCount(ar));
+
+    Details::LoadRequestedColumns<ArchiveT, T, Indexes...>(ar, count, columns, std::make_index_sequence<T::SerializationSchema::NumFields>());
+
+    return columns;
+}
+
+template <typename ArchiveT, typename T, typename AllocatorT, typename CharT, typename TraitsT>
+std::vector<T, AllocatorT> & DeserializeColumns(std::basic_istream<CharT, TraitsT> &s, std::vector<T, AllocatorT> &items) {
+    ArchiveT                                ar(s);
+
+    return DeserializeColumns(ar, items);
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SerializeRange.h
+///  \brief         Contains the SerializeRange and DeserializeRange functions
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 19:02:11
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/Serialization.h>
+
+#include <boost/serialization/collection_size_type.hpp>
+
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+namespace Details {
+
+template <typename T>
+constexpr bool const IsRangeElement = has_SerializationPOD<T> && CommonHelpers::TypeTraits::IsSmartPointer<T> == false;
+
+template <typename ArchiveT>
+size_t DeserializeRangeCount(ArchiveT &ar) {
+    boost::serialization::collection_size_type          count;
+
+    LoadNamed(ar, "count", count);
+    return static_cast<size_t>(count);
+}
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      SerializeRange
+///  \brief         Serializes a range of objects generated by SERIALIZATION.
+///                 The number of elements is written once, followed by each
+///                 element, with the same archive and tag used for all of
+///                 them.
+///
+///                 Example:
+///                     std::vector<MyObj> const                            items(...);
+///
+///                     SerializeRange(ar, items.begin(), items.end());
+///
+///                     // ...
+///
+///                     std::vector<MyObj>                                  new_items;
+///
+///                     DeserializeRange<boost::archive::binary_iarchive, MyObj>(in_ar, new_items);
+///
+template <typename ArchiveT, typename ForwardIteratorT>
+ArchiveT & SerializeRange(ArchiveT &ar, ForwardIteratorT first, ForwardIteratorT last) {
+    using T                                 = typename std::iterator_traits<ForwardIteratorT>::value_type;
+
+    static_assert(Details::IsRangeElement<T>, "SerializeRange is only available for types generated by SERIALIZATION");
+
+    boost::serialization::collection_size_type const    count(static_cast<size_t>(std::distance(first, last)));
+
+    Details::SaveNamed(ar, "count", count);
+
+    while(first != last) {
+        typename T::SerializationPOD::SerializeData const   data(*first);
+
+        Details::SaveNamed(ar, "item", data);
+        ++first;
+    }
+
+    return ar;
+}
+
+template <typename ArchiveT, typename ForwardIteratorT, typename CharT, typename TraitsT>
+std::basic_ostream<CharT, TraitsT> & SerializeRange(std::basic_ostream<CharT, TraitsT> &s, ForwardIteratorT first, ForwardIteratorT last) {
+    ArchiveT                                ar(s);
+
+    SerializeRange(ar, first, last);
+    return s;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeserializeRange
+///  \brief         Deserializes a range of objects written by SerializeRange,
+///                 assigning each element to the output iterator. Returns the
+///                 output iterator positioned after the last element.
+///
+template <typename ArchiveT, typename T, typename OutputIteratorT>
+OutputIteratorT DeserializeRange(ArchiveT &ar, OutputIteratorT output) {
+    static_assert(Details::IsRangeElement<T>, "DeserializeRange is only available for types generated by SERIALIZATION");
+
+    size_t                                  count(Details::DeserializeRangeCount(ar));
+
+    while(count--) {
+        typename T::SerializationPOD::DeserializeData       data;
+
+        Details::LoadNamed(ar, "item", data);
+
+        *output = T(std::move(data));
+        ++output;
+    }
+
+    return output;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      DeserializeRange
+///  \brief         Deserializes a range of objects written by SerializeRange,
+///                 appending them to the vector. Storage for all of the elements
+///                 is reserved up front and each element is constructed in
+///                 place from its DeserializeData.
+///
+template <typename ArchiveT, typename T, typename AllocatorT>
+std::vector<T, AllocatorT> & DeserializeRange(ArchiveT &ar, std::vector<T, AllocatorT> &items) {
+    static_assert(Details::IsRangeElement<T>, "DeserializeRange is only available for types generated by SERIALIZATION");
+
+    size_t                                  count(Details::DeserializeRangeCount(ar));
+
+    items.reserve(items.size() + count);
+
+    while(count--) {
+        typename T::SerializationPOD::DeserializeData       data;
+
+        Details::LoadNamed(ar, "item", data);
+        items.emplace_back(std::move(data));
+    }
+
+    return items;
+}
+
+template <typename ArchiveT, typename T, typename DestinationT, typename CharT, typename TraitsT>
+decltype(auto) DeserializeRange(std::basic_istream<CharT, TraitsT> &s, DestinationT &&destination) {
+    ArchiveT                                ar(s);
+
+    return DeserializeRange<ArchiveT, T>(ar, std::forward<DestinationT>(destination));
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
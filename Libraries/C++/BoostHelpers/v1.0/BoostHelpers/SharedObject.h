@@ -24,8 +24,132 @@
 #include <CommonHelpers/SharedObject.h>
 #include <BoostHelpers/Serialization.h>
 
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////////////
+///  \def           SHARED_OBJECT_POOLED
+///  \brief         Opts a SharedObject-based type (and the types derived from
+///                 it) into pooled allocation: CreateImpl allocates the object
+///                 and its shared_ptr control block with SharedObjectPoolAllocator
+///                 and objects created by `new` (which includes objects created
+///                 by boost when deserializing pointers) are allocated from the
+///                 same pool.
+///
+///                 Example:
+///                     struct Node : public SharedObject {
+///                         CREATE(Node);
+///                         SHARED_OBJECT_POOLED();
+///
+///                         // ...
+///                     };
+///
+#define SHARED_OBJECT_POOLED()                                                                          \
+    static constexpr bool const IsSharedObjectPooled = true;                                            \
+                                                                                                        \
+    static void * operator new(size_t cBytes) {                                                         \
+        return BoostHelpers::Details::SharedObjectPool::Allocate(cBytes);                               \
+    }                                                                                                   \
+                                                                                                        \
+    static void operator delete(void *pMemory, size_t cBytes) noexcept {                                \
+        BoostHelpers::Details::SharedObjectPool::Deallocate(pMemory, cBytes);                           \
+    }
+
 namespace BoostHelpers {
 
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SharedObjectPool
+///  \brief         Thread-local cache of memory blocks grouped by size class.
+///                 Freed blocks are cached by the thread that frees them and
+///                 reused (most recently freed first) by the next allocation of
+///                 the same size class on that thread, so steady-state
+///                 allocations don't contend on the global heap and return
+///                 memory that is likely to be in cache.
+///
+///                 Each block is allocated individually by the global
+///                 `operator new`, so blocks may be freed on any thread (and
+///                 by the global `operator delete`); blocks larger than
+///                 MaxBlockSize aren't cached.
+///
+class SharedObjectPool {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    static constexpr size_t const Granularity = alignof(std::max_align_t);
+    static constexpr size_t const MaxBlockSize = 512;
+    static constexpr size_t const MaxCachedBlocks = 4096;           ///< Per size class and thread
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    static void * Allocate(size_t cBytes);
+    static void Deallocate(void *pMemory, size_t cBytes) noexcept;
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    struct Block {
+        Block *                             pNext;
+    };
+
+    struct SizeClass {
+        Block *                             pHead;
+        size_t                              numBlocks;
+    };
+
+    static constexpr size_t const NumSizeClasses = MaxBlockSize / Granularity;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    static SizeClass * GetSizeClasses(void);
+    static size_t GetSizeClassIndex(size_t cBytes) { return cBytes ? (cBytes - 1) / Granularity : 0; }
+};
+
+template <typename T, typename EnableIfT=void>
+constexpr bool const IsSharedObjectPooled   = false;
+
+template <typename T>
+constexpr bool const IsSharedObjectPooled<T, std::enable_if_t<T::IsSharedObjectPooled>> = true;
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SharedObjectPoolAllocator
+///  \brief         Standard allocator based on Details::SharedObjectPool.
+///
+template <typename T>
+class SharedObjectPoolAllocator {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using value_type                        = T;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    SharedObjectPoolAllocator(void) = default;
+
+    template <typename OtherT>
+    SharedObjectPoolAllocator(SharedObjectPoolAllocator<OtherT> const &) {}
+
+    T * allocate(size_t n) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+        return static_cast<T *>(Details::SharedObjectPool::Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n) noexcept {
+        Details::SharedObjectPool::Deallocate(p, n * sizeof(T));
+    }
+
+    template <typename OtherT>
+    bool operator ==(SharedObjectPoolAllocator<OtherT> const &) const { return true; }
+
+    template <typename OtherT>
+    bool operator !=(SharedObjectPoolAllocator<OtherT> const &) const { return false; }
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         SharedObject
 ///  \brief         This object is essentially the same as CommonHelpers::SharedObject,
@@ -64,6 +188,9 @@ namespace BoostHelpers {
 ///                     std::shared_ptr<Derived>        pNewDerived(pDerived->CreateSharedPtr<Derived>());
 ///                     std::shared_ptr<Base>           pNewBaseFromDerived(pDerived->CreateSharedPtr<Base>());
 ///
+///                 Types that are created and destroyed frequently can opt into
+///                 pooled allocation with SHARED_OBJECT_POOLED.
+///
 class SharedObject : public std::enable_shared_from_this<SharedObject> {
 private:
     // ----------------------------------------------------------------------
@@ -116,7 +243,90 @@ std::shared_ptr<T> SharedObject::CreateSharedPtr(void) const {
 template <typename T, typename... ArgTs>
 // static
 std::shared_ptr<T> SharedObject::CreateImpl(ArgTs &&...args) {
-    return std::make_shared<T>(PrivateConstructorTag(), std::forward<ArgTs>(args)...);
+    if constexpr(Details::IsSharedObjectPooled<T>)
+        return std::allocate_shared<T>(SharedObjectPoolAllocator<T>(), PrivateConstructorTag(), std::forward<ArgTs>(args)...);
+    else
+        return std::make_shared<T>(PrivateConstructorTag(), std::forward<ArgTs>(args)...);
+}
+
+namespace Details {
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// static
+inline void * SharedObjectPool::Allocate(size_t cBytes) {
+    if(cBytes > MaxBlockSize)
+        return ::operator new(cBytes);
+
+    size_t const                            index(GetSizeClassIndex(cBytes));
+    SizeClass * const                       pSizeClasses(GetSizeClasses());
+
+    if(pSizeClasses && pSizeClasses[index].pHead) {
+        SizeClass &                         sizeClass(pSizeClasses[index]);
+        Block * const                       pBlock(sizeClass.pHead);
+
+        sizeClass.pHead = pBlock->pNext;
+        --sizeClass.numBlocks;
+
+        return pBlock;
+    }
+
+    return ::operator new((index + 1) * Granularity);
+}
+
+// static
+inline void SharedObjectPool::Deallocate(void *pMemory, size_t cBytes) noexcept {
+    if(pMemory == nullptr)
+        return;
+
+    SizeClass * const                       pSizeClasses(cBytes <= MaxBlockSize ? GetSizeClasses() : nullptr);
+
+    if(pSizeClasses) {
+        SizeClass &                         sizeClass(pSizeClasses[GetSizeClassIndex(cBytes)]);
+
+        if(sizeClass.numBlocks < MaxCachedBlocks) {
+            sizeClass.pHead = new (pMemory) Block{ sizeClass.pHead };
+            ++sizeClass.numBlocks;
+
+            return;
+        }
+    }
+
+    ::operator delete(pMemory);
 }
 
+// static
+inline SharedObjectPool::SizeClass * SharedObjectPool::GetSizeClasses(void) {
+    // The size classes are trivially destructible so that they remain valid
+    // while other thread-local objects (that may free blocks) are destroyed;
+    // blocks aren't cached once the cleanup object has been destroyed.
+    static thread_local SizeClass           sizeClasses[NumSizeClasses];
+    static thread_local bool                isDestroyed(false);
+
+    struct Cleanup {
+        ~Cleanup(void) {
+            isDestroyed = true;
+
+            for(SizeClass &sizeClass : sizeClasses) {
+                while(sizeClass.pHead) {
+                    Block * const           pBlock(sizeClass.pHead);
+
+                    sizeClass.pHead = pBlock->pNext;
+                    ::operator delete(pBlock);
+                }
+
+                sizeClass.numBlocks = 0;
+            }
+        }
+    };
+
+    static thread_local Cleanup const       cleanup;
+
+    (void)cleanup;
+    return isDestroyed ? nullptr : sizeClasses;
+}
+
+} // namespace Details
+
 } // namespace BoostHelpers
@@ -0,0 +1,358 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          StreamReader.h
+///  \brief         Contains the StreamReader object
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-15 09:12:37
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <BoostHelpers/SerializeRange.h>
+
+#include <boost/serialization/array_optimization.hpp>
+#include <boost/serialization/array_wrapper.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/detail/stack_constructor.hpp>
+#include <boost/serialization/item_version_type.hpp>
+#include <boost/serialization/level.hpp>
+#include <boost/serialization/library_version_type.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace BoostHelpers {
+namespace Serialization {
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          StreamFormat
+///  \brief         The format of the sequence read by StreamReader.
+///
+enum class StreamFormat {
+    Range,                                  ///< Written by SerializeRange
+    Vector                                  ///< Written by boost's std::vector serialization
+};
+
+namespace Details {
+
+template <typename ArchiveT, typename T>
+constexpr bool const IsStreamArrayOptimized = boost::serialization::use_array_optimization<ArchiveT>::template apply<std::remove_const_t<T>>::type::value;
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        StreamVectorHeader
+///  \brief         Reads the count and item version written by boost's
+///                 std::vector serialization. The archive treats this type
+///                 like std::vector<T> (see the implementation_level
+///                 specialization below), so the class information that
+///                 precedes the vector is consumed when the header is read.
+///
+template <typename T>
+struct StreamVectorHeader {
+    boost::serialization::collection_size_type          count;
+    boost::serialization::item_version_type             itemVersion;
+
+    template <typename ArchiveT>
+    void serialize(ArchiveT &ar, unsigned int const) {
+        static_assert(ArchiveT::is_loading::value, "StreamVectorHeader can only be loaded");
+
+        boost::serialization::library_version_type const    libraryVersion(ar.get_library_version());
+
+        LoadNamed(ar, "count", count);
+
+        if constexpr(IsStreamArrayOptimized<ArchiveT, T>) {
+            if(BOOST_SERIALIZATION_VECTOR_VERSIONED(libraryVersion))
+                LoadNamed(ar, "item_version", itemVersion);
+        }
+        else {
+            if(boost::serialization::library_version_type(3) < libraryVersion)
+                LoadNamed(ar, "item_version", itemVersion);
+        }
+    }
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         StreamReader
+///  \brief         Input iterator that deserializes the elements of a sequence
+///                 one at a time, so that a sequence can be processed without
+///                 holding all of its elements in memory.
+///
+///                 Example:
+///                     for(MyObj &obj : StreamReader<boost::archive::binary_iarchive, MyObj>(in))
+///                         Process(obj);
+///
+///                 With StreamFormat::Range, the sequence must have been written
+///                 by SerializeRange and T must be a type generated by SERIALIZATION.
+///
+///                 With StreamFormat::Vector, the sequence must have been written
+///                 as a std::vector<T> (for example, `ar << items`) and T can be any
+///                 type supported by boost serialization; the elements are read
+///                 exactly as boost would read them when loading the vector. Boost
+///                 writes class information for std::vector<T> the first time that
+///                 the type is written to an archive, so any std::vector<T> that
+///                 precedes the sequence in the archive must have been read by a
+///                 StreamReader as well. This format isn't supported by XML archives,
+///                 as the elements are nested within the vector's element.
+///
+///                 The current element is destroyed when the iterator is advanced;
+///                 move it out of the iterator to keep it. Copies of an iterator share
+///                 the same position, and the archive must remain valid while any copy
+///                 is in use.
+///
+template <typename ArchiveT, typename T>
+class StreamReader {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Types
+    using Archive                           = ArchiveT;
+    using Type                              = T;
+
+    using iterator_category                 = std::input_iterator_tag;
+    using value_type                        = T;
+    using difference_type                   = std::ptrdiff_t;
+    using pointer                           = T *;
+    using reference                         = T &;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+
+    /// Creates the end iterator.
+    StreamReader(void) = default;
+
+    StreamReader(ArchiveT &ar, StreamFormat format=StreamFormat::Range);
+
+    template <typename CharT, typename TraitsT>
+    StreamReader(std::basic_istream<CharT, TraitsT> &s, StreamFormat format=StreamFormat::Range);
+
+    /// Returns the number of elements that follow the current element.
+    size_t GetRemaining(void) const;
+
+    reference operator *(void) const;
+    pointer operator ->(void) const;
+
+    StreamReader & operator ++(void);
+    void operator ++(int);
+
+    bool operator ==(StreamReader const &other) const;
+    bool operator !=(StreamReader const &other) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Types
+    struct State {
+        std::optional<ArchiveT>             archive;
+        ArchiveT *                          pArchive;
+        StreamFormat                        format;
+        size_t                              remaining;
+        boost::serialization::item_version_type             itemVersion;
+        std::optional<T>                    value;
+    };
+
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    std::shared_ptr<State>                  _state;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    void Initialize(void);
+    void ReadNext(void);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      begin
+///  \brief         Returns the reader, so that it can be used in range-based
+///                 for loops.
+///
+template <typename ArchiveT, typename T>
+StreamReader<ArchiveT, T> begin(StreamReader<ArchiveT, T> reader) {
+    return reader;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \function      end
+///  \brief         Returns the end iterator.
+///
+template <typename ArchiveT, typename T>
+StreamReader<ArchiveT, T> end(StreamReader<ArchiveT, T> const &) {
+    return StreamReader<ArchiveT, T>();
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename ArchiveT, typename T>
+StreamReader<ArchiveT, T>::StreamReader(ArchiveT &ar, StreamFormat format) :
+    _state(std::make_shared<State>())
+{
+    _state->pArchive = &ar;
+    _state->format = format;
+
+    Initialize();
+}
+
+template <typename ArchiveT, typename T>
+template <typename CharT, typename TraitsT>
+StreamReader<ArchiveT, T>::StreamReader(std::basic_istream<CharT, TraitsT> &s, StreamFormat format) :
+    _state(std::make_shared<State>())
+{
+    _state->archive.emplace(s);
+    _state->pArchive = &(*_state->archive);
+    _state->format = format;
+
+    Initialize();
+}
+
+template <typename ArchiveT, typename T>
+size_t StreamReader<ArchiveT, T>::GetRemaining(void) const {
+    return _state ? _state->remaining : 0;
+}
+
+template <typename ArchiveT, typename T>
+typename StreamReader<ArchiveT, T>::reference StreamReader<ArchiveT, T>::operator *(void) const {
+    if(!_state || _state->value.has_value() == false)
+        throw std::logic_error("The iterator is at the end of the sequence");
+
+    return *_state->value;
+}
+
+template <typename ArchiveT, typename T>
+typename StreamReader<ArchiveT, T>::pointer StreamReader<ArchiveT, T>::operator ->(void) const {
+    return &operator *();
+}
+
+template <typename ArchiveT, typename T>
+StreamReader<ArchiveT, T> & StreamReader<ArchiveT, T>::operator ++(void) {
+    if(!_state || _state->value.has_value() == false)
+        throw std::logic_error("The iterator is at the end of the sequence");
+
+    ReadNext();
+    return *this;
+}
+
+template <typename ArchiveT, typename T>
+void StreamReader<ArchiveT, T>::operator ++(int) {
+    ++(*this);
+}
+
+template <typename ArchiveT, typename T>
+bool StreamReader<ArchiveT, T>::operator ==(StreamReader const &other) const {
+    bool const                              isEnd(!_state || _state->value.has_value() == false);
+    bool const                              isOtherEnd(!other._state || other._state->value.has_value() == false);
+
+    if(isEnd || isOtherEnd)
+        return isEnd == isOtherEnd;
+
+    return _state == other._state;
+}
+
+template <typename ArchiveT, typename T>
+bool StreamReader<ArchiveT, T>::operator !=(StreamReader const &other) const {
+    return !(*this == other);
+}
+
+// ----------------------------------------------------------------------
+template <typename ArchiveT, typename T>
+void StreamReader<ArchiveT, T>::Initialize(void) {
+    State &                                 state(*_state);
+
+    if(state.format == StreamFormat::Range) {
+        if constexpr(Details::IsRangeElement<T>)
+            state.remaining = Details::DeserializeRangeCount(*state.pArchive);
+        else
+            throw std::invalid_argument("StreamFormat::Range is only available for types generated by SERIALIZATION");
+    }
+    else if(state.format == StreamFormat::Vector) {
+        Details::StreamVectorHeader<T>      header;
+
+        Details::LoadNamed(*state.pArchive, "items", header);
+
+        state.remaining = static_cast<size_t>(header.count);
+        state.itemVersion = header.itemVersion;
+    }
+    else
+        throw std::invalid_argument("format");
+
+    ReadNext();
+}
+
+template <typename ArchiveT, typename T>
+void StreamReader<ArchiveT, T>::ReadNext(void) {
+    State &                                 state(*_state);
+    ArchiveT &                              ar(*state.pArchive);
+
+    state.value.reset();
+
+    if(state.remaining == 0)
+        return;
+
+    --state.remaining;
+
+    if(state.format == StreamFormat::Range) {
+        if constexpr(Details::IsRangeElement<T>) {
+            typename T::SerializationPOD::DeserializeData   data;
+
+            Details::LoadNamed(ar, "item", data);
+            state.value.emplace(std::move(data));
+        }
+    }
+    else if constexpr(Details::IsStreamArrayOptimized<ArchiveT, T>) {
+        // The elements were written as a single array; reading them one at a time
+        // consumes the same bytes.
+        state.value.emplace();
+        ar >> boost::serialization::make_array(&(*state.value), 1);
+    }
+    else if constexpr(std::is_default_constructible_v<T>) {
+        state.value.emplace();
+        Details::LoadNamed(ar, "item", *state.value);
+    }
+    else {
+        boost::serialization::detail::stack_construct<ArchiveT, T>      item(ar, state.itemVersion);
+
+        Details::LoadNamed(ar, "item", item.reference());
+
+        state.value.emplace(std::move(item.reference()));
+        ar.reset_object_address(&(*state.value), &item.reference());
+    }
+}
+
+} // namespace Serialization
+} // namespace BoostHelpers
+
+namespace boost {
+namespace serialization {
+
+// Ensure that the archive reads the same class information for the header that it would
+// read for std::vector<T>.
+template <typename T>
+struct implementation_level<BoostHelpers::Serialization::Details::StreamVectorHeader<T>> : public implementation_level<std::vector<T>> {
+};
+
+}  // namespace serialization
+}  // namespace boost
@@ -21,8 +21,12 @@
 /////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "CompactArchive.h"
 #include "Serialization.h"
+#include "SerializeColumns.h"
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
@@ -30,13 +34,112 @@
 
 #include "Serialization.suffix.h"
 
+#include <cstddef>
+#include <cstdlib>
 #include <functional>
+#include <map>
+#include <new>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace BoostHelpers {
 namespace TestHelpers {
 
+/////////////////////////////////////////////////////////////////////////
+///  \enum          TestArchive
+///  \brief         The archives used by SerializeTest and SerializePtrTest;
+///                 the value is the index returned when the test fails for
+///                 the archive.
+///
+enum class TestArchive : unsigned char {
+    Text = 1,
+    Xml = 2,
+    Compact = 3,
+    Binary = 4,
+    Columns = 5                             ///< SerializeColumns with binary archives (SerializeTest only, for types supported by SerializeColumns)
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        TestArchiveTraits
+///  \brief         The output and input archive types used for a TestArchive
+///                 (Columns uses the Binary archives).
+///
+template <TestArchive ArchiveV>
+struct TestArchiveTraits;
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ForEachTestArchive
+///  \brief         Invokes the functor with the TestArchiveTraits of each of
+///                 the archives (Text, Xml, Compact and Binary when none are
+///                 provided); used to test functionality that reads and writes
+///                 archives in ways other than those covered by SerializeTest.
+///
+///                 Example:
+///                     ForEachTestArchive<TestArchive::Text, TestArchive::Binary>(
+///                         [](auto traits) {
+///                             using Traits = decltype(traits);
+///
+///                             Test<typename Traits::OArchive, typename Traits::IArchive>();
+///                         }
+///                     );
+///
+template <TestArchive... ArchivesV, typename FuncT>
+void ForEachTestArchive(FuncT const &func);
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SerializeTestResult
+///  \brief         Information about a round trip through an archive.
+///
+struct SerializeTestResult {
+    TestArchive                             archive;
+
+    /// Number of bytes written, including the archive header
+    size_t                                  numBytes;
+
+    /// Number of allocations made while the object was serialized and deserialized
+    /// (including those made by the streams used by the test), or std::nullopt if
+    /// TEST_HELPERS_COUNT_ALLOCATIONS isn't defined.
+    std::optional<size_t>                   numAllocations;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SerializeTestLimits
+///  \brief         Upper bounds for a round trip through an archive; the test
+///                 fails when a value exceeds its limit.
+///
+struct SerializeTestLimits {
+    std::optional<size_t>                   maxBytes;
+
+    /// Requires TEST_HELPERS_COUNT_ALLOCATIONS; std::invalid_argument is thrown
+    /// when this value is provided and allocations aren't counted.
+    std::optional<size_t>                   maxAllocations;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SerializeTestOptions
+///  \brief         Options for SerializeTest and SerializePtrTest.
+///
+///                 Define TEST_HELPERS_COUNT_ALLOCATIONS before including this
+///                 file to count allocations; the global operator new and operator
+///                 delete are replaced when it is defined, so this file must only be
+///                 included in one file of the executable (which is already the case,
+///                 as it includes Serialization.suffix.h).
+///
+struct SerializeTestOptions {
+    /// Invoked with the data written to each archive
+    std::optional<std::function<void (std::string const &)>>               onSerializedFunc;
+
+    /// Invoked with the result of each round trip (before the limits are checked)
+    std::optional<std::function<void (SerializeTestResult const &)>>       onResultFunc;
+
+    std::map<TestArchive, SerializeTestLimits>                              limits;
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \fn            SerializeTest
 ///  \brief         Test that verifies serialization for an object. Returns
@@ -46,6 +149,9 @@ namespace TestHelpers {
 template <typename T>
 unsigned char SerializeTest(T const &obj, std::optional<std::function<void (std::string const &)>> const &onSerializedFunc=std::nullopt);
 
+template <typename T>
+unsigned char SerializeTest(T const &obj, SerializeTestOptions const &options);
+
 /////////////////////////////////////////////////////////////////////////
 ///  \fn            SerializePtrTest
 ///  \brief         Test that verifies serialization via pointer for an object.
@@ -55,6 +161,9 @@ unsigned char SerializeTest(T const &obj, std::optional<std::function<void (std:
 template <typename T, typename DerivedT=typename T::element_type>
 unsigned char SerializePtrTest(T const &obj, std::optional<std::function<void (std::string const &)>> const &onSerializedFunc=std::nullopt);
 
+template <typename T, typename DerivedT=typename T::element_type>
+unsigned char SerializePtrTest(T const &obj, SerializeTestOptions const &options);
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -66,67 +175,277 @@ unsigned char SerializePtrTest(T const &obj, std::optional<std::function<void (s
 // ----------------------------------------------------------------------
 namespace Details {
 
-template <typename OArchiveT, typename IArchiveT, typename T>
-bool SerializeTestImpl(T const &obj, std::optional<std::function<void (std::string const &)>> const &onSerializedFunc) {
-    std::ostringstream                      out;
+#if (defined TEST_HELPERS_COUNT_ALLOCATIONS)
+constexpr bool const IsCountingAllocations  = true;
+#else
+constexpr bool const IsCountingAllocations  = false;
+#endif
+
+/// Number of allocations made by the current thread (only updated when
+/// TEST_HELPERS_COUNT_ALLOCATIONS is defined).
+inline size_t & GetNumAllocations(void) {
+    static thread_local size_t              numAllocations(0);
+
+    return numAllocations;
+}
+
+template <typename T>
+constexpr bool const IsColumnsTestElement =
+    Serialization::Details::IsColumnElementImpl<T>
+    && std::is_move_constructible_v<T>;
+
+template <typename T>
+constexpr bool IsColumnsTestType(void) {
+    if constexpr(IsColumnsTestElement<T>)
+        return T::SerializationSchema::IsCustom == false && std::tuple_size_v<typename T::SerializationSchema::BaseTypes> == 0;
+    else
+        return false;
+}
+
+template <typename SerializeFuncT, typename DeserializeFuncT>
+bool RoundTripTestImpl(TestArchive archive, SerializeTestOptions const &options, SerializeFuncT const &serializeFunc, DeserializeFuncT const &deserializeFunc) {
+    size_t const                            serializeStart(GetNumAllocations());
+    std::string const                       result(serializeFunc());
+    size_t                                  numAllocations(GetNumAllocations() - serializeStart);
+
+    // Allocations made by the callback aren't counted
+    if(options.onSerializedFunc) {
+        assert(*options.onSerializedFunc);
+        (*options.onSerializedFunc)(result);
+    }
+
+    size_t const                            deserializeStart(GetNumAllocations());
+    bool const                              isEqual(deserializeFunc(result));
+
+    numAllocations += GetNumAllocations() - deserializeStart;
+
+    SerializeTestResult const               testResult{
+        archive,
+        result.size(),
+        IsCountingAllocations ? std::optional<size_t>(numAllocations) : std::nullopt
+    };
+
+    if(options.onResultFunc) {
+        assert(*options.onResultFunc);
+        (*options.onResultFunc)(testResult);
+    }
 
-    obj.template Serialize<OArchiveT>(out);
-    out.flush();
+    if(isEqual == false)
+        return false;
 
-    std::string                             result(out.str());
+    auto const                              iter(options.limits.find(archive));
 
-    if(onSerializedFunc) {
-        assert(*onSerializedFunc);
-        (*onSerializedFunc)(result);
+    if(iter == options.limits.end())
+        return true;
+
+    SerializeTestLimits const &             limits(iter->second);
+
+    if(limits.maxBytes && testResult.numBytes > *limits.maxBytes)
+        return false;
+
+    if(limits.maxAllocations) {
+        if(testResult.numAllocations.has_value() == false)
+            throw std::invalid_argument("Allocations are only counted when TEST_HELPERS_COUNT_ALLOCATIONS is defined");
+
+        if(*testResult.numAllocations > *limits.maxAllocations)
+            return false;
     }
 
-    std::istringstream                      in(result);
-    T const                                 other(T::template Deserialize<IArchiveT>(in));
+    return true;
+}
+
+template <typename OArchiveT, typename IArchiveT, typename T>
+bool SerializeTestImpl(T const &obj, TestArchive archive, SerializeTestOptions const &options) {
+    return RoundTripTestImpl(
+        archive,
+        options,
+        [&obj](void) {
+            std::ostringstream              out;
+
+            obj.template Serialize<OArchiveT>(out);
+            out.flush();
+
+            return out.str();
+        },
+        [&obj](std::string const &result) {
+            std::istringstream              in(result);
+            T const                         other(T::template Deserialize<IArchiveT>(in));
+
+            return other == obj;
+        }
+    );
+}
+
+template <typename T>
+bool SerializeColumnsTestImpl(T const &obj, SerializeTestOptions const &options) {
+    return RoundTripTestImpl(
+        TestArchive::Columns,
+        options,
+        [&obj](void) {
+            std::ostringstream              out;
+
+            Serialization::SerializeColumns<boost::archive::binary_oarchive>(out, &obj, &obj + 1);
+            out.flush();
+
+            return out.str();
+        },
+        [&obj](std::string const &result) {
+            std::istringstream              in(result);
+            boost::archive::binary_iarchive ar(in);
+            std::vector<T>                  items;
 
-    return other == obj;
+            Serialization::DeserializeColumns(ar, items);
+
+            return items.size() == 1 && items[0] == obj;
+        }
+    );
 }
 
 template <typename OArchiveT, typename IArchiveT, typename DerivedT, typename T>
-bool SerializePtrTestImpl(T const &obj, std::optional<std::function<void (std::string const &)>> const &onSerializedFunc) {
-    std::ostringstream                      out;
+bool SerializePtrTestImpl(T const &obj, TestArchive archive, SerializeTestOptions const &options) {
+    return RoundTripTestImpl(
+        archive,
+        options,
+        [&obj](void) {
+            std::ostringstream              out;
 
-    obj->template SerializePtr<OArchiveT>(out);
-    out.flush();
+            obj->template SerializePtr<OArchiveT>(out);
+            out.flush();
 
-    std::string                             result(out.str());
+            return out.str();
+        },
+        [&obj](std::string const &result) {
+            std::istringstream              in(result);
+            auto const                      other(DerivedT::template DeserializePtr<IArchiveT>(in));
 
-    if(onSerializedFunc) {
-        assert(*onSerializedFunc);
-        (*onSerializedFunc)(result);
-    }
+            return *other == *static_cast<DerivedT const *>(obj.get());
+        }
+    );
+}
 
-    std::istringstream                      in(result);
-    auto const                              other(DerivedT::template DeserializePtr<IArchiveT>(in));
+inline SerializeTestOptions CreateSerializeTestOptions(std::optional<std::function<void (std::string const &)>> const &onSerializedFunc) {
+    SerializeTestOptions                    options;
 
-    return *other == *static_cast<DerivedT const *>(obj.get());
+    options.onSerializedFunc = onSerializedFunc;
+    return options;
 }
 
 } // namespace Details
 
+template <>
+struct TestArchiveTraits<TestArchive::Text> {
+    static constexpr TestArchive const      Archive = TestArchive::Text;
+    static constexpr char const * const     Name = "Text";
+
+    using OArchive                          = boost::archive::text_oarchive;
+    using IArchive                          = boost::archive::text_iarchive;
+};
+
+template <>
+struct TestArchiveTraits<TestArchive::Xml> {
+    static constexpr TestArchive const      Archive = TestArchive::Xml;
+    static constexpr char const * const     Name = "Xml";
+
+    using OArchive                          = boost::archive::xml_oarchive;
+    using IArchive                          = boost::archive::xml_iarchive;
+};
+
+template <>
+struct TestArchiveTraits<TestArchive::Compact> {
+    static constexpr TestArchive const      Archive = TestArchive::Compact;
+    static constexpr char const * const     Name = "Compact";
+
+    using OArchive                          = Serialization::compact_oarchive;
+    using IArchive                          = Serialization::compact_iarchive;
+};
+
+template <>
+struct TestArchiveTraits<TestArchive::Binary> {
+    static constexpr TestArchive const      Archive = TestArchive::Binary;
+    static constexpr char const * const     Name = "Binary";
+
+    using OArchive                          = boost::archive::binary_oarchive;
+    using IArchive                          = boost::archive::binary_iarchive;
+};
+
+template <>
+struct TestArchiveTraits<TestArchive::Columns> : public TestArchiveTraits<TestArchive::Binary> {
+    static constexpr TestArchive const      Archive = TestArchive::Columns;
+    static constexpr char const * const     Name = "Columns";
+};
+
+template <TestArchive... ArchivesV, typename FuncT>
+void ForEachTestArchive(FuncT const &func) {
+    if constexpr(sizeof...(ArchivesV) == 0)
+        ForEachTestArchive<TestArchive::Text, TestArchive::Xml, TestArchive::Compact, TestArchive::Binary>(func);
+    else
+        (func(TestArchiveTraits<ArchivesV>()), ...);
+}
+
 template <typename T>
 unsigned char SerializeTest(T const &obj, std::optional<std::function<void (std::string const &)>> const &onSerializedFunc/*=std::nullopt*/) {
-    if(Details::SerializeTestImpl<boost::archive::text_oarchive, boost::archive::text_iarchive>(obj, onSerializedFunc) == false)
-        return 1;
-    if(Details::SerializeTestImpl<boost::archive::xml_oarchive, boost::archive::xml_iarchive>(obj, onSerializedFunc) == false)
-        return 2;
+    return SerializeTest(obj, Details::CreateSerializeTestOptions(onSerializedFunc));
+}
+
+template <typename T>
+unsigned char SerializeTest(T const &obj, SerializeTestOptions const &options) {
+    if(Details::SerializeTestImpl<boost::archive::text_oarchive, boost::archive::text_iarchive>(obj, TestArchive::Text, options) == false)
+        return static_cast<unsigned char>(TestArchive::Text);
+    if(Details::SerializeTestImpl<boost::archive::xml_oarchive, boost::archive::xml_iarchive>(obj, TestArchive::Xml, options) == false)
+        return static_cast<unsigned char>(TestArchive::Xml);
+    if(Details::SerializeTestImpl<Serialization::compact_oarchive, Serialization::compact_iarchive>(obj, TestArchive::Compact, options) == false)
+        return static_cast<unsigned char>(TestArchive::Compact);
+    if(Details::SerializeTestImpl<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(obj, TestArchive::Binary, options) == false)
+        return static_cast<unsigned char>(TestArchive::Binary);
+
+    if constexpr(Details::IsColumnsTestType<T>()) {
+        if(Details::SerializeColumnsTestImpl(obj, options) == false)
+            return static_cast<unsigned char>(TestArchive::Columns);
+    }
 
     return 0;
 }
 
 template <typename T, typename DerivedT/*=typename T::element_type*/>
 unsigned char SerializePtrTest(T const &obj, std::optional<std::function<void (std::string const &)>> const &onSerializedFunc/*=std::nullopt*/) {
-    if(Details::SerializePtrTestImpl<boost::archive::text_oarchive, boost::archive::text_iarchive, DerivedT>(obj, onSerializedFunc) == false)
-        return 1;
-    if(Details::SerializePtrTestImpl<boost::archive::xml_oarchive, boost::archive::xml_iarchive, DerivedT>(obj, onSerializedFunc) == false)
-        return 2;
+    return SerializePtrTest<T, DerivedT>(obj, Details::CreateSerializeTestOptions(onSerializedFunc));
+}
+
+template <typename T, typename DerivedT/*=typename T::element_type*/>
+unsigned char SerializePtrTest(T const &obj, SerializeTestOptions const &options) {
+    if(Details::SerializePtrTestImpl<boost::archive::text_oarchive, boost::archive::text_iarchive, DerivedT>(obj, TestArchive::Text, options) == false)
+        return static_cast<unsigned char>(TestArchive::Text);
+    if(Details::SerializePtrTestImpl<boost::archive::xml_oarchive, boost::archive::xml_iarchive, DerivedT>(obj, TestArchive::Xml, options) == false)
+        return static_cast<unsigned char>(TestArchive::Xml);
+    if(Details::SerializePtrTestImpl<Serialization::compact_oarchive, Serialization::compact_iarchive, DerivedT>(obj, TestArchive::Compact, options) == false)
+        return static_cast<unsigned char>(TestArchive::Compact);
+    if(Details::SerializePtrTestImpl<boost::archive::binary_oarchive, boost::archive::binary_iarchive, DerivedT>(obj, TestArchive::Binary, options) == false)
+        return static_cast<unsigned char>(TestArchive::Binary);
 
     return 0;
 }
 
 } // namespace TestHelpers
 } // namespace BoostHelpers
+
+#if (defined TEST_HELPERS_COUNT_ALLOCATIONS)
+
+// The default implementations of the array and nothrow forms call these functions.
+void * operator new(std::size_t cBytes) {
+    ++BoostHelpers::TestHelpers::Details::GetNumAllocations();
+
+    if(void * const pMemory = std::malloc(cBytes ? cBytes : 1))
+        return pMemory;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pMemory) noexcept {
+    std::free(pMemory);
+}
+
+void operator delete(void *pMemory, std::size_t) noexcept {
+    std::free(pMemory);
+}
+
+#endif
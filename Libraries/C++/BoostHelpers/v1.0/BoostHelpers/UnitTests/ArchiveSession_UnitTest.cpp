@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ArchiveSession_UnitTest.cpp
+///  \brief         Unit test for ArchiveSession.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 10:41:05
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../ArchiveSession.h"
+#include <catch.hpp>
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Copy.h>
+#include <CommonHelpers/Constructor.h>
+#include <CommonHelpers/Move.h>
+
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unique_ptr.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "../TestHelpers.h"
+
+struct StatelessObj {
+    int const                               i;
+    std::string const                       s;
+
+    CONSTRUCTOR(StatelessObj, i, s);
+    NON_COPYABLE(StatelessObj);
+    MOVE(StatelessObj, i, s);
+    COMPARE(StatelessObj, i, s);
+    SERIALIZATION(StatelessObj, i, s);
+};
+
+struct NestedStatelessObj {
+    StatelessObj const                      obj;
+    bool const                              b;
+
+    CONSTRUCTOR(NestedStatelessObj, obj, b);
+    NON_COPYABLE(NestedStatelessObj);
+    MOVE(NestedStatelessObj, obj, b);
+    COMPARE(NestedStatelessObj, obj, b);
+    SERIALIZATION(NestedStatelessObj, obj, b);
+};
+
+struct StatefulObj {
+    int const                               i;
+    std::unique_ptr<StatelessObj> const     pObj;
+
+    CONSTRUCTOR(StatefulObj, i, pObj);
+    NON_COPYABLE(StatefulObj);
+    MOVE(StatefulObj, i, pObj);
+    COMPARE(StatefulObj, i, pObj);
+    SERIALIZATION(StatefulObj, i, pObj);
+};
+
+TEST_CASE("Objects") {
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(StatelessObj(1, "one")) == 0);
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(NestedStatelessObj(StatelessObj(4, "four"), true)) == 0);
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(StatefulObj(2, std::make_unique<StatelessObj>(3, "three"))) == 0);
+}
+
+TEST_CASE("IsArchiveStateless") {
+    CHECK(BoostHelpers::Serialization::Details::IsArchiveStatelessMember<StatelessObj>());
+    CHECK(BoostHelpers::Serialization::Details::IsArchiveStatelessMember<NestedStatelessObj>());
+    CHECK(BoostHelpers::Serialization::Details::IsArchiveStatelessMember<StatefulObj>() == false);
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void TestImpl(void) {
+    std::ostringstream                      out;
+
+    {
+        BoostHelpers::Serialization::ArchiveSession<OArchiveT>              session(out);
+
+        StatelessObj(1, "one").Serialize(session);
+        StatefulObj(2, std::make_unique<StatelessObj>(3, "three")).Serialize(session);
+        StatefulObj(2, std::make_unique<StatelessObj>(3, "three")).Serialize(session);
+        NestedStatelessObj(StatelessObj(4, "four"), true).Serialize(session);
+        StatelessObj(5, "five").Serialize(session);
+    }
+
+    std::string const                       result(out.str());
+
+    UNSCOPED_INFO(result);
+
+    std::istringstream                      in(result);
+    BoostHelpers::Serialization::ArchiveSession<IArchiveT>                  session(in);
+
+    CHECK(CommonHelpers::Compare(StatelessObj::Deserialize(session), StatelessObj(1, "one")) == 0);
+    CHECK(CommonHelpers::Compare(StatefulObj::Deserialize(session), StatefulObj(2, std::make_unique<StatelessObj>(3, "three"))) == 0);
+    CHECK(CommonHelpers::Compare(StatefulObj::Deserialize(session), StatefulObj(2, std::make_unique<StatelessObj>(3, "three"))) == 0);
+    CHECK(CommonHelpers::Compare(NestedStatelessObj::Deserialize(session), NestedStatelessObj(StatelessObj(4, "four"), true)) == 0);
+    CHECK(CommonHelpers::Compare(StatelessObj::Deserialize(session), StatelessObj(5, "five")) == 0);
+}
+
+TEST_CASE("Archives") {
+    BoostHelpers::TestHelpers::ForEachTestArchive(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>();
+        }
+    );
+}
+
+TEST_CASE("Independent messages") {
+    std::ostringstream                      out;
+    std::vector<size_t>                     offsets;
+
+    {
+        BoostHelpers::Serialization::ArchiveSession<boost::archive::binary_oarchive>    session(out);
+
+        for(int i = 0; i < 3; ++i) {
+            StatefulObj(2, std::make_unique<StatelessObj>(3, "three")).Serialize(session);
+            offsets.push_back(static_cast<size_t>(out.tellp()));
+        }
+    }
+
+    std::string const                       result(out.str());
+
+    // Class information for the pointer is written with every message, so each
+    // message can be deserialized on its own.
+    CHECK(result.substr(0, offsets[0]) == result.substr(offsets[0], offsets[1] - offsets[0]));
+    CHECK(result.substr(0, offsets[0]) == result.substr(offsets[1], offsets[2] - offsets[1]));
+
+    // Start reading with the last message
+    std::istringstream                      in(result.substr(offsets[1]));
+    BoostHelpers::Serialization::ArchiveSession<boost::archive::binary_iarchive>    session(in);
+
+    CHECK(CommonHelpers::Compare(StatefulObj::Deserialize(session), StatefulObj(2, std::make_unique<StatelessObj>(3, "three"))) == 0);
+}
+
+TEST_CASE("No header") {
+    std::ostringstream                      out;
+
+    {
+        BoostHelpers::Serialization::ArchiveSession<boost::archive::binary_oarchive>    session(out, boost::archive::no_codecvt);
+
+        StatelessObj(1, "one").Serialize(session);
+    }
+
+    std::ostringstream                      expected;
+
+    {
+        boost::archive::binary_oarchive     ar(expected, boost::archive::no_header | boost::archive::no_codecvt);
+
+        StatelessObj(1, "one").Serialize(ar);
+    }
+
+    CHECK(out.str() == expected.str());
+}
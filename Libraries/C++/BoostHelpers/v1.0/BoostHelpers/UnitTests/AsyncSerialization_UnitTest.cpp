@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          AsyncSerialization_UnitTest.cpp
+///  \brief         Unit test for AsyncSerialization.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 23:41:09
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../AsyncSerialization.h"
+#include <catch.hpp>
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Copy.h>
+#include <CommonHelpers/Constructor.h>
+#include <CommonHelpers/Move.h>
+
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unique_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "../TestHelpers.h"
+
+struct Entry {
+    int const                               id;
+    std::string const                       value;
+
+    CONSTRUCTOR(Entry, id, value);
+    NON_COPYABLE(Entry);
+    MOVE(Entry, id, value);
+    COMPARE(Entry, id, value);
+    SERIALIZATION(Entry, id, value);
+};
+
+struct Checkpoint {
+    std::string const                       name;
+    std::vector<Entry> const                entries;
+    std::unique_ptr<Entry> const            pLatest;
+
+    CONSTRUCTOR(Checkpoint, name, entries, pLatest);
+    NON_COPYABLE(Checkpoint);
+    MOVE(Checkpoint, name, entries, pLatest);
+    COMPARE(Checkpoint, name, entries, pLatest);
+    SERIALIZATION(Checkpoint, name, entries, pLatest);
+};
+
+Checkpoint CreateCheckpoint(size_t numEntries) {
+    std::vector<Entry>                      entries;
+
+    for(size_t index = 0; index < numEntries; ++index) {
+        int const                           value(static_cast<int>(index));
+
+        entries.emplace_back(value, std::to_string(value));
+    }
+
+    return Checkpoint("Checkpoint", std::move(entries), std::make_unique<Entry>(-1, "latest"));
+}
+
+TEST_CASE("Objects") {
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(CreateCheckpoint(0)) == 0);
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(CreateCheckpoint(10)) == 0);
+}
+
+template <typename OArchiveT>
+void TestImpl(size_t numEntries, size_t chunkSize) {
+    Checkpoint const                        checkpoint(CreateCheckpoint(numEntries));
+    std::ostringstream                      expected;
+
+    checkpoint.template Serialize<OArchiveT>(expected);
+
+    std::ostringstream                      out;
+    std::future<void>                       result(BoostHelpers::Serialization::SerializeAsync<OArchiveT>(out, checkpoint, chunkSize));
+
+    result.get();
+
+    // The object is round tripped by SerializeTest (see "Objects"), so the output
+    // only needs to match the synchronous output.
+    CHECK(out.str() == expected.str());
+}
+
+template <typename OArchiveT>
+void TestImpl(void) {
+    TestImpl<OArchiveT>(0, 1);
+    TestImpl<OArchiveT>(10, 1);
+    TestImpl<OArchiveT>(1000, 7);
+    TestImpl<OArchiveT>(1000, 4096);
+    TestImpl<OArchiveT>(1000, BoostHelpers::Serialization::DefaultAsyncChunkSize);
+}
+
+TEST_CASE("Archives") {
+    BoostHelpers::TestHelpers::ForEachTestArchive(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            TestImpl<typename Traits::OArchive>();
+        }
+    );
+}
+
+TEST_CASE("Multiple objects") {
+    // Objects can be written to different streams at the same time
+    Checkpoint const                        checkpoint1(CreateCheckpoint(500));
+    Checkpoint const                        checkpoint2(CreateCheckpoint(1000));
+    std::ostringstream                      out1;
+    std::ostringstream                      out2;
+
+    std::future<void>                       result1(BoostHelpers::Serialization::SerializeAsync<boost::archive::binary_oarchive>(out1, checkpoint1, 64));
+    std::future<void>                       result2(BoostHelpers::Serialization::SerializeAsync<boost::archive::binary_oarchive>(out2, checkpoint2, 64));
+
+    result1.get();
+    result2.get();
+
+    std::istringstream                      in1(out1.str());
+    std::istringstream                      in2(out2.str());
+
+    CHECK(CommonHelpers::Compare(Checkpoint::Deserialize<boost::archive::binary_iarchive>(in1), checkpoint1) == 0);
+    CHECK(CommonHelpers::Compare(Checkpoint::Deserialize<boost::archive::binary_iarchive>(in2), checkpoint2) == 0);
+}
+
+TEST_CASE("Consumed objects") {
+    Checkpoint const                        expected(CreateCheckpoint(1000));
+    std::ostringstream                      expectedOut;
+
+    expected.Serialize<boost::archive::binary_oarchive>(expectedOut);
+
+    // The object is owned by the background task
+    std::ostringstream                      out;
+    std::future<void>                       result;
+
+    {
+        Checkpoint                          checkpoint(CreateCheckpoint(1000));
+
+        result = BoostHelpers::Serialization::SerializeAsync<boost::archive::binary_oarchive>(out, std::move(checkpoint), 64);
+        CHECK(checkpoint.entries.empty());
+    }
+
+    result.get();
+
+    CHECK(out.str() == expectedOut.str());
+
+    // Non-const lvalues are not consumed
+    Checkpoint                              checkpoint(CreateCheckpoint(10));
+    std::ostringstream                      lvalueOut;
+
+    BoostHelpers::Serialization::SerializeAsync<boost::archive::binary_oarchive>(lvalueOut, checkpoint).get();
+
+    CHECK(checkpoint.entries.size() == 10);
+
+    std::istringstream                      in(lvalueOut.str());
+
+    CHECK(CommonHelpers::Compare(Checkpoint::Deserialize<boost::archive::binary_iarchive>(in), checkpoint) == 0);
+}
+
+TEST_CASE("Errors") {
+    Checkpoint const                        checkpoint(CreateCheckpoint(100));
+
+    {
+        std::ostringstream                  out;
+
+        CHECK_THROWS_AS(BoostHelpers::Serialization::SerializeAsync<boost::archive::binary_oarchive>(out, checkpoint, 0), std::invalid_argument);
+    }
+
+    // Errors are provided by the future
+    {
+        std::ostringstream                  out;
+
+        out.setstate(std::ios_base::badbit);
+
+        std::future<void>                   result(BoostHelpers::Serialization::SerializeAsync<boost::archive::binary_oarchive>(out, checkpoint, 16));
+
+        CHECK_THROWS(result.get());
+    }
+}
@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          ChunkedSerialization_UnitTest.cpp
+///  \brief         Unit test for ChunkedSerialization.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 20:36:15
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../ChunkedSerialization.h"
+#include <catch.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "SequenceTestObjs.h"
+#include "../TestHelpers.h"
+
+template <typename OArchiveT, typename IArchiveT>
+void TestImpl(size_t num_objs, size_t elements_per_block) {
+    std::vector<Obj> const                  objs(CreateObjs(num_objs));
+    std::string                             result;
+
+    for(size_t max_concurrency : { 1, 2, 8 }) {
+        std::ostringstream                  out;
+
+        BoostHelpers::Serialization::SerializeChunked<OArchiveT>(out, objs.begin(), objs.end(), elements_per_block, max_concurrency);
+
+        // The output doesn't depend on the number of threads
+        if(result.empty())
+            result = out.str();
+        else
+            CHECK(out.str() == result);
+    }
+
+    for(size_t max_concurrency : { 1, 2, 8 }) {
+        std::istringstream                  in(result);
+
+        CHECK(CommonHelpers::Compare(BoostHelpers::Serialization::DeserializeChunked<IArchiveT, Obj>(in, max_concurrency), objs) == 0);
+    }
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void TestImpl(void) {
+    TestImpl<OArchiveT, IArchiveT>(0, 10);
+    TestImpl<OArchiveT, IArchiveT>(1, 10);
+    TestImpl<OArchiveT, IArchiveT>(10, 1);
+    TestImpl<OArchiveT, IArchiveT>(100, 7);
+    TestImpl<OArchiveT, IArchiveT>(100, 100);
+    TestImpl<OArchiveT, IArchiveT>(100, 1000);
+}
+
+TEST_CASE("Archives") {
+    using namespace BoostHelpers::TestHelpers;
+
+    ForEachTestArchive<TestArchive::Text, TestArchive::Xml, TestArchive::Binary>(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>();
+        }
+    );
+}
+
+TEST_CASE("Block sizes") {
+    std::vector<Obj> const                  objs(CreateObjs(10));
+    std::ostringstream                      out;
+
+    BoostHelpers::Serialization::SerializeChunked<boost::archive::binary_oarchive>(out, objs.begin(), objs.end(), 4);
+
+    std::istringstream                      in(out.str());
+
+    CHECK(BoostHelpers::Serialization::Details::ReadChunkedValue(in) == 3);
+
+    // The index can be used to skip blocks
+    for(size_t expected : { 4, 4 }) {
+        CHECK(BoostHelpers::Serialization::Details::ReadChunkedValue(in) == expected);
+        in.seekg(static_cast<std::streamoff>(BoostHelpers::Serialization::Details::ReadChunkedValue(in)), std::ios_base::cur);
+    }
+
+    CHECK(BoostHelpers::Serialization::Details::ReadChunkedValue(in) == 2);
+
+    size_t const                            blockSize(BoostHelpers::Serialization::Details::ReadChunkedValue(in));
+    std::string                             block(blockSize, '\0');
+
+    REQUIRE(in.read(block.data(), static_cast<std::streamsize>(blockSize)));
+
+    std::istringstream                      blockIn(block);
+    boost::archive::binary_iarchive         ar(blockIn);
+    std::vector<Obj>                        items;
+
+    BoostHelpers::Serialization::DeserializeRange<boost::archive::binary_iarchive, Obj>(ar, items);
+
+    REQUIRE(items.size() == 2);
+    CHECK(CommonHelpers::Compare(items[0], objs[8]) == 0);
+    CHECK(CommonHelpers::Compare(items[1], objs[9]) == 0);
+}
+
+TEST_CASE("Errors") {
+    std::vector<Obj> const                  objs(CreateObjs(10));
+
+    {
+        std::ostringstream                  out;
+
+        CHECK_THROWS_MATCHES(
+            BoostHelpers::Serialization::SerializeChunked<boost::archive::binary_oarchive>(out, objs.begin(), objs.end(), 0),
+            std::invalid_argument,
+            Catch::Matchers::Message("elements_per_block")
+        );
+    }
+
+    std::ostringstream                      out;
+
+    BoostHelpers::Serialization::SerializeChunked<boost::archive::binary_oarchive>(out, objs.begin(), objs.end(), 4);
+
+    std::string const                       result(out.str());
+    std::istringstream                      in(result.substr(0, result.size() - 1));
+
+    CHECK_THROWS_MATCHES(
+        (BoostHelpers::Serialization::DeserializeChunked<boost::archive::binary_iarchive, Obj>(in)),
+        std::runtime_error,
+        Catch::Matchers::Message("Invalid chunked data")
+    );
+}
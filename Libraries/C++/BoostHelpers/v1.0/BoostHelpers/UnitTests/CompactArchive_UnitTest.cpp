@@ -0,0 +1,230 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompactArchive_UnitTest.cpp
+///  \brief         Unit test for CompactArchive.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 22:18:36
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../CompactArchive.h"
+#include <catch.hpp>
+
+#include "../ArchiveSession.h"
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Copy.h>
+#include <CommonHelpers/Constructor.h>
+#include <CommonHelpers/Move.h>
+
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unique_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include "../TestHelpers.h"
+
+#include <limits>
+
+using BoostHelpers::Serialization::compact_iarchive;
+using BoostHelpers::Serialization::compact_oarchive;
+
+template <typename T>
+std::string SaveValue(T const &value) {
+    std::ostringstream                      out;
+
+    compact_oarchive(out, boost::archive::no_header) << value;
+    return out.str();
+}
+
+template <typename T>
+T LoadValue(std::string const &data) {
+    std::istringstream                      in(data);
+    T                                       result;
+
+    compact_iarchive(in, boost::archive::no_header) >> result;
+    return result;
+}
+
+template <typename T>
+size_t TestValue(T const &value) {
+    std::string const                       data(SaveValue(value));
+
+    CHECK(LoadValue<T>(data) == value);
+    return data.size();
+}
+
+TEST_CASE("Varints") {
+    CHECK(TestValue(0) == 1);
+    CHECK(TestValue(1) == 1);
+    CHECK(TestValue(-1) == 1);
+    CHECK(TestValue(63) == 1);
+    CHECK(TestValue(-64) == 1);
+    CHECK(TestValue(64) == 2);
+    CHECK(TestValue(std::numeric_limits<int>::max()) == 5);
+    CHECK(TestValue(std::numeric_limits<int>::min()) == 5);
+
+    CHECK(TestValue(127u) == 1);
+    CHECK(TestValue(128u) == 2);
+    CHECK(TestValue(std::numeric_limits<std::uint64_t>::max()) == 10);
+    CHECK(TestValue(std::numeric_limits<std::int64_t>::min()) == 10);
+    CHECK(TestValue(static_cast<std::int16_t>(-300)) == 2);
+    CHECK(TestValue(static_cast<std::uint16_t>(65535)) == 3);
+
+    // Raw values
+    CHECK(TestValue('c') == 1);
+    CHECK(TestValue(true) == 1);
+    CHECK(TestValue(1.5) == sizeof(double));
+    CHECK(TestValue(2.5f) == sizeof(float));
+
+    // Strings write their size as a varint
+    CHECK(TestValue(std::string("abc")) == 4);
+    CHECK(TestValue(std::wstring(L"abc")) == 4);
+    CHECK(TestValue(std::string(200, 'x')) == 202);
+
+    // Invalid content
+    CHECK_THROWS_AS(LoadValue<int>(""), boost::archive::archive_exception);
+    CHECK_THROWS_AS(LoadValue<int>("\x80"), boost::archive::archive_exception);
+    CHECK_THROWS_AS(LoadValue<std::uint16_t>(SaveValue(static_cast<std::uint32_t>(65536))), boost::archive::archive_exception);
+    CHECK_THROWS_AS(LoadValue<std::string>(SaveValue(std::string("abc")).substr(0, 2)), boost::archive::archive_exception);
+}
+
+struct Leg {
+    int const                               quantity;
+    std::string const                       symbol;
+
+    CONSTRUCTOR(Leg, quantity, symbol);
+    NON_COPYABLE(Leg);
+    MOVE(Leg, quantity, symbol);
+    COMPARE(Leg, quantity, symbol);
+    SERIALIZATION(Leg, quantity, symbol);
+};
+
+struct Order {
+    std::uint64_t const                     id;
+    std::int32_t const                      price;
+    std::vector<std::int16_t> const         fills;
+    std::map<std::string, int> const        tags;
+    std::unique_ptr<Leg> const              pLeg;
+
+    CONSTRUCTOR(Order, id, price, fills, tags, pLeg);
+    NON_COPYABLE(Order);
+    MOVE(Order, id, price, fills, tags, pLeg);
+    COMPARE(Order, id, price, fills, tags, pLeg);
+    SERIALIZATION(Order, id, price, fills, tags, pLeg);
+};
+
+struct BaseObj {
+    int const                               a;
+
+    CONSTRUCTOR(BaseObj, a);
+    COMPARE(BaseObj, a);
+    SERIALIZATION(BaseObj, MEMBERS(a), FLAGS(SERIALIZATION_POLYMORPHIC_BASE));
+
+    virtual ~BaseObj(void) = default;
+};
+
+struct DerivedObj : public BaseObj {
+    std::string const                       s;
+
+    CONSTRUCTOR(DerivedObj, MEMBERS(s), BASES(BaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    COMPARE(DerivedObj, MEMBERS(s), BASES(BaseObj));
+    SERIALIZATION(DerivedObj, MEMBERS(s), BASES(BaseObj), FLAGS(SERIALIZATION_POLYMORPHIC(BaseObj)));
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(BaseObj);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(DerivedObj);
+
+Order CreateOrder(void) {
+    return Order(
+        12345,
+        -250,
+        std::vector<std::int16_t>{ 1, -2, 3 },
+        std::map<std::string, int>{ { "one", 1 }, { "two", 2 } },
+        std::make_unique<Leg>(10, "ABC")
+    );
+}
+
+template <typename OArchiveT, typename T>
+std::string Save(T const &value) {
+    std::ostringstream                      out;
+
+    value.template Serialize<OArchiveT>(out);
+    return out.str();
+}
+
+TEST_CASE("SERIALIZATION types") {
+    Order const                             order(CreateOrder());
+
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(order) == 0);
+
+    std::string const                       result(Save<compact_oarchive>(order));
+
+    // Names and type tables aren't written
+    CHECK(result.find("pLeg") == std::string::npos);
+    CHECK(result.find("Leg") == std::string::npos);
+
+    CHECK(result.size() < Save<boost::archive::binary_oarchive>(order).size() / 2);
+
+    // Polymorphic objects are identified by name
+    {
+        DerivedObj const                    obj(10, "ten");
+        std::ostringstream                  out;
+
+        obj.SerializePtr<compact_oarchive>(out);
+
+        std::istringstream                  in(out.str());
+        std::unique_ptr<BaseObj> const      other(BaseObj::DeserializePtr<compact_iarchive>(in));
+
+        REQUIRE(dynamic_cast<DerivedObj const *>(other.get()));
+        CHECK(CommonHelpers::Compare(static_cast<DerivedObj const &>(*other), obj) == 0);
+    }
+
+    // Archives written by newer versions of boost
+    {
+        std::string                         invalid(result);
+
+        invalid[0] = static_cast<char>(0x7F);
+
+        std::istringstream                  in(invalid);
+
+        CHECK_THROWS_AS(Order::Deserialize<compact_iarchive>(in), boost::archive::archive_exception);
+    }
+}
+
+TEST_CASE("ArchiveSession") {
+    Order const                             order(CreateOrder());
+    std::ostringstream                      out;
+
+    {
+        BoostHelpers::Serialization::ArchiveSession<compact_oarchive>       session(out);
+
+        order.Serialize(session);
+        Leg(1, "one").Serialize(session);
+        Leg(2, "two").Serialize(session);
+    }
+
+    std::istringstream                                                      in(out.str());
+    BoostHelpers::Serialization::ArchiveSession<compact_iarchive>           session(in);
+
+    CHECK(CommonHelpers::Compare(Order::Deserialize(session), order) == 0);
+    CHECK(CommonHelpers::Compare(Leg::Deserialize(session), Leg(1, "one")) == 0);
+    CHECK(CommonHelpers::Compare(Leg::Deserialize(session), Leg(2, "two")) == 0);
+}
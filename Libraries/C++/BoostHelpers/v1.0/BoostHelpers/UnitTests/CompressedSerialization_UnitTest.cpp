@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          CompressedSerialization_UnitTest.cpp
+///  \brief         Unit test for CompressedSerialization.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 23:02:47
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../CompressedSerialization.h"
+#include <catch.hpp>
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Copy.h>
+#include <CommonHelpers/Constructor.h>
+#include <CommonHelpers/Move.h>
+
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "../TestHelpers.h"
+
+struct Snapshot {
+    std::string const                       name;
+    std::vector<int> const                  values;
+
+    CONSTRUCTOR(Snapshot, name, values);
+    NON_COPYABLE(Snapshot);
+    MOVE(Snapshot, name, values);
+    COMPARE(Snapshot, name, values);
+    SERIALIZATION(Snapshot, name, values);
+};
+
+Snapshot CreateSnapshot(int value) {
+    std::vector<int>                        values;
+
+    for(int index = 0; index < 10000; ++index)
+        values.emplace_back(value + index % 10);
+
+    return Snapshot("Snapshot" + std::to_string(value), std::move(values));
+}
+
+TEST_CASE("Objects") {
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(CreateSnapshot(10)) == 0);
+}
+
+template <typename OArchiveT, typename IArchiveT, typename CodecT>
+void TestImpl(CodecT &codec) {
+    Snapshot const                          snapshot(CreateSnapshot(10));
+    std::ostringstream                      uncompressedOut;
+
+    snapshot.template Serialize<OArchiveT>(uncompressedOut);
+
+    // The codec is reused for each call
+    for(int iteration = 0; iteration < 3; ++iteration) {
+        std::ostringstream                  out;
+
+        BoostHelpers::Serialization::SerializeCompressed<OArchiveT>(out, snapshot, codec);
+
+        std::string const                   result(out.str());
+
+        CHECK(result.size() * 5 < uncompressedOut.str().size());
+
+        std::istringstream                  in(result);
+
+        CHECK(CommonHelpers::Compare(BoostHelpers::Serialization::DeserializeCompressed<IArchiveT, Snapshot>(in, codec), snapshot) == 0);
+    }
+}
+
+template <typename CodecT>
+void TestImpl(CodecT &codec) {
+    BoostHelpers::TestHelpers::ForEachTestArchive(
+        [&codec](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>(codec);
+        }
+    );
+}
+
+TEST_CASE("Zstd") {
+    BoostHelpers::Serialization::ZstdCodec                                  codec;
+
+    TestImpl(codec);
+}
+
+TEST_CASE("Zlib") {
+    BoostHelpers::Serialization::ZlibCodec                                  codec;
+
+    TestImpl(codec);
+}
+
+TEST_CASE("Block size") {
+    BoostHelpers::Serialization::ZstdCodec                                  smallCodec(boost::iostreams::zstd_params(), 16);
+    BoostHelpers::Serialization::ZstdCodec                                  largeCodec(boost::iostreams::zstd_params(), 1024 * 1024);
+
+    CHECK(smallCodec.GetBlockSize() == 16);
+    CHECK(largeCodec.GetBlockSize() == 1024 * 1024);
+
+    TestImpl<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(smallCodec);
+    TestImpl<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(largeCodec);
+
+    // Content written with one block size can be read with another
+    Snapshot const                          snapshot(CreateSnapshot(20));
+    std::ostringstream                      out;
+
+    BoostHelpers::Serialization::SerializeCompressed<boost::archive::binary_oarchive>(out, snapshot, smallCodec);
+
+    std::istringstream                      in(out.str());
+
+    CHECK(CommonHelpers::Compare(BoostHelpers::Serialization::DeserializeCompressed<boost::archive::binary_iarchive, Snapshot>(in, largeCodec), snapshot) == 0);
+
+    CHECK_THROWS_AS(BoostHelpers::Serialization::ZstdCodec(boost::iostreams::zstd_params(), 0), std::invalid_argument);
+}
@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          MappedReader_UnitTest.cpp
+///  \brief         Unit test for MappedReader.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 21:40:03
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../MappedReader.h"
+#include <catch.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "SequenceTestObjs.h"
+#include "../TestHelpers.h"
+
+#include <filesystem>
+#include <fstream>
+
+// Doesn't add state to the archive
+struct StatelessObj {
+    int const                               i;
+    std::string const                       s;
+    InnerObj const                          inner;
+
+    CONSTRUCTOR(StatelessObj, i, s, inner);
+    NON_COPYABLE(StatelessObj);
+    MOVE(StatelessObj, i, s, inner);
+    COMPARE(StatelessObj, i, s, inner);
+    SERIALIZATION(StatelessObj, i, s, inner);
+
+    static StatelessObj Create(size_t index) {
+        int const                           value(static_cast<int>(index));
+
+        return StatelessObj(value, std::to_string(value), InnerObj(value * 10));
+    }
+};
+
+TEST_CASE("Objects") {
+    // Element offsets are only recorded for stateless types
+    CHECK(BoostHelpers::Serialization::Details::IsArchiveStatelessMember<StatelessObj>());
+    CHECK(BoostHelpers::Serialization::Details::IsArchiveStatelessMember<Obj>() == false);
+
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(StatelessObj::Create(1)) == 0);
+}
+
+template <typename OArchiveT, typename IArchiveT, typename T>
+void TestImpl(BoostHelpers::Serialization::MappedFileFormat format, size_t num_objs) {
+    std::vector<T> const                    objs(CreateObjs<T>(num_objs));
+    std::ostringstream                      out;
+
+    if(format == BoostHelpers::Serialization::MappedFileFormat::Chunked)
+        BoostHelpers::Serialization::SerializeChunked<OArchiveT>(out, objs.begin(), objs.end(), 7);
+    else
+        BoostHelpers::Serialization::SerializeRange<OArchiveT>(out, objs.begin(), objs.end());
+
+    std::string const                       data(out.str());
+    BoostHelpers::Serialization::MappedReader<IArchiveT, T> const           reader(data.data(), data.size(), format);
+
+    REQUIRE(reader.GetSize() == num_objs);
+
+    // Access the elements out of order, and more than once
+    for(size_t index = num_objs; index > 0; --index)
+        CHECK(CommonHelpers::Compare(reader.Get(index - 1), objs[index - 1]) == 0);
+
+    for(size_t index = 0; index < num_objs; ++index)
+        CHECK(CommonHelpers::Compare(reader.Get(index), objs[index]) == 0);
+
+    CHECK_THROWS_MATCHES(reader.Get(num_objs), std::out_of_range, Catch::Matchers::Message("index"));
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void TestImpl(void) {
+    for(auto format : { BoostHelpers::Serialization::MappedFileFormat::Chunked, BoostHelpers::Serialization::MappedFileFormat::Range }) {
+        for(size_t num_objs : { 0, 1, 7, 20 }) {
+            TestImpl<OArchiveT, IArchiveT, StatelessObj>(format, num_objs);
+            TestImpl<OArchiveT, IArchiveT, Obj>(format, num_objs);
+        }
+    }
+}
+
+TEST_CASE("Archives") {
+    using namespace BoostHelpers::TestHelpers;
+
+    ForEachTestArchive<TestArchive::Text, TestArchive::Xml, TestArchive::Binary>(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>();
+        }
+    );
+}
+
+TEST_CASE("File") {
+    std::vector<StatelessObj> const         objs(CreateObjs<StatelessObj>(100));
+    std::string const                       filename((std::filesystem::temp_directory_path() / "MappedReader_UnitTest.dat").string());
+
+    {
+        std::ofstream                       out(filename, std::ios_base::binary);
+
+        BoostHelpers::Serialization::SerializeChunked<boost::archive::binary_oarchive>(out, objs.begin(), objs.end(), 8);
+    }
+
+    {
+        BoostHelpers::Serialization::MappedReader<boost::archive::binary_iarchive, StatelessObj> const  reader(filename);
+
+        REQUIRE(reader.GetSize() == objs.size());
+        CHECK(CommonHelpers::Compare(reader.Get(99), objs[99]) == 0);
+        CHECK(CommonHelpers::Compare(reader.Get(42), objs[42]) == 0);
+        CHECK(CommonHelpers::Compare(reader.Get(0), objs[0]) == 0);
+        CHECK(CommonHelpers::Compare(reader.Get(43), objs[43]) == 0);
+    }
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Invalid data") {
+    std::vector<StatelessObj> const         objs(CreateObjs<StatelessObj>(10));
+    std::ostringstream                      out;
+
+    BoostHelpers::Serialization::SerializeChunked<boost::archive::binary_oarchive>(out, objs.begin(), objs.end(), 4);
+
+    std::string const                       data(out.str());
+
+    CHECK_THROWS_MATCHES(
+        (BoostHelpers::Serialization::MappedReader<boost::archive::binary_iarchive, StatelessObj>(data.data(), data.size() - 1)),
+        std::runtime_error,
+        Catch::Matchers::Message("Invalid chunked data")
+    );
+}
@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SequenceTestObjs.h
+///  \brief         Objects used by the unit tests for functionality that
+///                 serializes sequences of objects
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-15 14:02:37
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Copy.h>
+#include <CommonHelpers/Constructor.h>
+#include <CommonHelpers/Move.h>
+
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unique_ptr.hpp>
+
+#include <BoostHelpers/Serialization.suffix.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct InnerObj {
+    int const                               i;
+
+    CONSTRUCTOR(InnerObj, i);
+    NON_COPYABLE(InnerObj);
+    MOVE(InnerObj, i);
+    COMPARE(InnerObj, i);
+    SERIALIZATION(InnerObj, i);
+};
+
+struct BaseObj {
+    int const                               i;
+
+    CONSTRUCTOR(BaseObj, i);
+    NON_COPYABLE(BaseObj);
+    MOVE(BaseObj, i);
+    COMPARE(BaseObj, i);
+    SERIALIZATION(BaseObj, i);
+};
+
+// Adds state to the archive when pInner is set
+struct Obj : public BaseObj {
+    std::string const                       s;
+    std::unique_ptr<InnerObj> const         pInner;
+
+    CONSTRUCTOR(Obj, MEMBERS(s, pInner), BASES(BaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    NON_COPYABLE(Obj);
+    MOVE(Obj, MEMBERS(s, pInner), BASES(BaseObj));
+    COMPARE(Obj, MEMBERS(s, pInner), BASES(BaseObj));
+    SERIALIZATION(Obj, MEMBERS(s, pInner), BASES(BaseObj));
+
+    static Obj Create(size_t index) {
+        int const                           value(static_cast<int>(index));
+
+        return Obj(value, std::to_string(value), index % 2 ? std::make_unique<InnerObj>(value * 10) : std::unique_ptr<InnerObj>());
+    }
+};
+
+template <typename T=Obj>
+std::vector<T> CreateObjs(size_t num_objs) {
+    std::vector<T>                          result;
+
+    for(size_t index = 0; index < num_objs; ++index)
+        result.emplace_back(T::Create(index));
+
+    return result;
+}
@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SerializationStats_UnitTest.cpp
+///  \brief         Unit test for SerializationStats.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-15 11:48:05
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#define SERIALIZATION_STATS
+#include "../Serialization.h"
+#include <catch.hpp>
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Constructor.h>
+
+#include <boost/serialization/string.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include "../Serialization.suffix.h"
+
+#include <limits>
+#include <numeric>
+
+struct Obj {
+    int const                               i;
+    std::string const                       s;
+
+    CONSTRUCTOR(Obj, i, s);
+    COMPARE(Obj, i, s);
+    SERIALIZATION(Obj, i, s);
+};
+
+struct BaseObj {
+    int const                               a;
+
+    CONSTRUCTOR(BaseObj, a);
+    COMPARE(BaseObj, a);
+    SERIALIZATION(BaseObj, MEMBERS(a), FLAGS(SERIALIZATION_POLYMORPHIC_BASE));
+
+    virtual ~BaseObj(void) = default;
+};
+
+struct DerivedObj : public BaseObj {
+    char const                              c;
+
+    CONSTRUCTOR(DerivedObj, MEMBERS(c), BASES(BaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    COMPARE(DerivedObj, MEMBERS(c), BASES(BaseObj));
+    SERIALIZATION(DerivedObj, MEMBERS(c), BASES(BaseObj), FLAGS(SERIALIZATION_POLYMORPHIC(BaseObj)));
+
+    ~DerivedObj(void) override = default;
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(BaseObj);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(DerivedObj);
+
+BoostHelpers::Serialization::SerializationOperationStats GetStats(char const *name, BoostHelpers::Serialization::SerializationOperation operation) {
+    for(auto const &stats : BoostHelpers::Serialization::GetSerializationStats()) {
+        if(stats.name == name)
+            return stats.Get(operation);
+    }
+
+    return BoostHelpers::Serialization::SerializationOperationStats();
+}
+
+std::uint64_t GetHistogramCalls(BoostHelpers::Serialization::SerializationOperationStats const &stats) {
+    return std::accumulate(stats.latencyHistogram.begin(), stats.latencyHistogram.end(), std::uint64_t(0));
+}
+
+TEST_CASE("Serialize and Deserialize") {
+    using Operation                         = BoostHelpers::Serialization::SerializationOperation;
+
+    BoostHelpers::Serialization::ResetSerializationStats();
+
+    Obj const                               obj(10, "ten");
+    std::ostringstream                      out1;
+    std::ostringstream                      out2;
+
+    obj.Serialize<boost::archive::binary_oarchive>(out1);
+    obj.Serialize<boost::archive::text_oarchive>(out2);
+
+    {
+        std::ostringstream                  out;
+        boost::archive::binary_oarchive     ar(out);
+
+        // The number of bytes isn't available when the archive is provided
+        obj.Serialize(ar);
+    }
+
+    auto const                              serializeStats(GetStats("Obj", Operation::Serialize));
+
+    CHECK(serializeStats.calls == 3);
+    CHECK(GetHistogramCalls(serializeStats) == 3);
+    CHECK(serializeStats.bytesCalls == 2);
+    CHECK(serializeStats.bytes == out1.str().size() + out2.str().size());
+
+    std::istringstream                      in(out1.str());
+
+    CHECK(CommonHelpers::Compare(Obj::Deserialize<boost::archive::binary_iarchive>(in), obj) == 0);
+
+    auto const                              deserializeStats(GetStats("Obj", Operation::Deserialize));
+
+    CHECK(deserializeStats.calls == 1);
+    CHECK(GetHistogramCalls(deserializeStats) == 1);
+    CHECK(deserializeStats.bytesCalls == 1);
+    CHECK(deserializeStats.bytes == out1.str().size());
+
+    CHECK(GetStats("Obj", Operation::SerializePtr).calls == 0);
+    CHECK(GetStats("Obj", Operation::DeserializePtr).calls == 0);
+
+    BoostHelpers::Serialization::ResetSerializationStats();
+
+    CHECK(GetStats("Obj", Operation::Serialize).calls == 0);
+    CHECK(GetStats("Obj", Operation::Serialize).bytes == 0);
+    CHECK(GetHistogramCalls(GetStats("Obj", Operation::Serialize)) == 0);
+}
+
+TEST_CASE("SerializePtr and DeserializePtr") {
+    using Operation                         = BoostHelpers::Serialization::SerializationOperation;
+
+    BoostHelpers::Serialization::ResetSerializationStats();
+
+    DerivedObj const                        obj(1, 'c');
+    std::ostringstream                      out;
+
+    obj.SerializePtr<boost::archive::binary_oarchive>(out);
+
+    std::istringstream                      in(out.str());
+    auto const                              pObj(BaseObj::DeserializePtr<boost::archive::binary_iarchive>(in));
+
+    CHECK(CommonHelpers::Compare(dynamic_cast<DerivedObj const &>(*pObj), obj) == 0);
+
+    // Calls are recorded for the type whose method was invoked
+    CHECK(GetStats("DerivedObj", Operation::SerializePtr).calls == 1);
+    CHECK(GetStats("DerivedObj", Operation::SerializePtr).bytes == out.str().size());
+    CHECK(GetStats("BaseObj", Operation::DeserializePtr).calls == 1);
+    CHECK(GetStats("BaseObj", Operation::DeserializePtr).bytes == out.str().size());
+    CHECK(GetStats("DerivedObj", Operation::DeserializePtr).calls == 0);
+}
+
+TEST_CASE("Latency buckets") {
+    using Counters                          = BoostHelpers::Serialization::Details::SerializationStatsCounters;
+
+    CHECK(Counters::GetLatencyBucket(0) == 0);
+    CHECK(Counters::GetLatencyBucket(1) == 0);
+    CHECK(Counters::GetLatencyBucket(2) == 1);
+    CHECK(Counters::GetLatencyBucket(3) == 1);
+    CHECK(Counters::GetLatencyBucket(1024) == 10);
+    CHECK(Counters::GetLatencyBucket(std::numeric_limits<std::uint64_t>::max()) == BoostHelpers::Serialization::NumSerializationLatencyBuckets - 1);
+}
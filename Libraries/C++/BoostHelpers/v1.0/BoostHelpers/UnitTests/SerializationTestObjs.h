@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SerializationTestObjs.h
+///  \brief         Objects used by the Serialization.h unit tests and
+///                 benchmarks
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-15 16:48:12
+///
+///  \note          This file defines the polymorphic types; include it in
+///                 a single translation unit per binary.
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Copy.h>
+#include <CommonHelpers/Constructor.h>
+#include <CommonHelpers/Move.h>
+#include <CommonHelpers/Stl.h>
+
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unique_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <BoostHelpers/Serialization.suffix.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct SingleMemberObj {
+    int const a;
+
+    CONSTRUCTOR(SingleMemberObj, a);
+    NON_COPYABLE(SingleMemberObj);
+    MOVE(SingleMemberObj, a);
+    COMPARE(SingleMemberObj, a);
+    SERIALIZATION(SingleMemberObj, a);
+};
+
+struct MultiMemberObj {
+    bool const b;
+    char const c;
+
+    CONSTRUCTOR(MultiMemberObj, MEMBERS(b, c));
+    NON_COPYABLE(MultiMemberObj);
+    MOVE(MultiMemberObj, MEMBERS(b, c));
+    COMPARE(MultiMemberObj, MEMBERS(b, c));
+    SERIALIZATION(MultiMemberObj, MEMBERS(b, c));
+};
+
+struct MultiMemberMultiBaseObj : public SingleMemberObj, public MultiMemberObj {
+    double const d;
+    float const f;
+    std::unique_ptr<MultiMemberObj> const pMultiMember;
+
+    CONSTRUCTOR(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj), FLAGS(CONSTRUCTOR_BASE_ARGS_1(2), CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    NON_COPYABLE(MultiMemberMultiBaseObj);
+    MOVE(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj));
+    COMPARE(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj));
+    SERIALIZATION(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj));
+};
+
+struct FlatObj {
+    int const                               i;
+    double const                            d;
+    bool const                              b;
+    std::string const                       s;
+
+    CONSTRUCTOR(FlatObj, i, d, b, s);
+    NON_COPYABLE(FlatObj);
+    MOVE(FlatObj, i, d, b, s);
+    COMPARE(FlatObj, i, d, b, s);
+    SERIALIZATION(FlatObj, i, d, b, s);
+};
+
+struct VectorObj {
+    std::vector<FlatObj> const              items;
+
+    CONSTRUCTOR(VectorObj, items);
+    NON_COPYABLE(VectorObj);
+    MOVE(VectorObj, items);
+    COMPARE(VectorObj, items);
+    SERIALIZATION(VectorObj, items);
+};
+
+struct BaseObj {
+    int const a;
+
+    CONSTRUCTOR(BaseObj, MEMBERS(a));
+    COMPARE(BaseObj, MEMBERS(a));
+    SERIALIZATION(BaseObj, MEMBERS(a), FLAGS(SERIALIZATION_ABSTRACT));
+
+    virtual ~BaseObj(void) = default;
+    virtual void Method1(void) const = 0;
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE(BaseObj);
+SERIALIZATION_POLYMORPHIC_DEFINE(BaseObj);
+
+struct AbstractObj : public BaseObj {
+    bool const b;
+
+    CONSTRUCTOR(AbstractObj, MEMBERS(b), BASES(BaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    NON_COPYABLE(AbstractObj);
+    NON_MOVABLE(AbstractObj);
+    COMPARE(AbstractObj, MEMBERS(b), BASES(BaseObj));
+    SERIALIZATION(AbstractObj, MEMBERS(b), BASES(BaseObj), FLAGS(SERIALIZATION_DATA_ONLY));
+
+    virtual ~AbstractObj(void) = default;
+    virtual void Method2(void) const = 0;
+};
+
+struct Derived1Obj : public AbstractObj {
+    char const c;
+
+    CONSTRUCTOR(Derived1Obj, MEMBERS(c), BASES(AbstractObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS, CONSTRUCTOR_BASE_ARGS_0(2)));
+    COMPARE(Derived1Obj, MEMBERS(c), BASES(AbstractObj));
+    SERIALIZATION(Derived1Obj, MEMBERS(c), BASES(AbstractObj), FLAGS(SERIALIZATION_POLYMORPHIC(BaseObj)));
+
+    ~Derived1Obj(void) override = default;
+
+    void Method1(void) const override {}
+    void Method2(void) const override {}
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE(Derived1Obj);
+SERIALIZATION_POLYMORPHIC_DEFINE(Derived1Obj);
+
+struct Derived2Obj : public AbstractObj {
+    double const d;
+
+    CONSTRUCTOR(Derived2Obj, MEMBERS(d), BASES(AbstractObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS, CONSTRUCTOR_BASE_ARGS_0(2)));
+    COMPARE(Derived2Obj, MEMBERS(d), BASES(AbstractObj));
+    SERIALIZATION(Derived2Obj, MEMBERS(d), BASES(AbstractObj), FLAGS(SERIALIZATION_POLYMORPHIC(BaseObj)));
+
+    ~Derived2Obj(void) override = default;
+
+    void Method1(void) const override {}
+    void Method2(void) const override {}
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Derived2Obj);
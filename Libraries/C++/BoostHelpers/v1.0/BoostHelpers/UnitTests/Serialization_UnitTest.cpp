@@ -31,16 +31,24 @@
 #include <CommonHelpers/Stl.h>
 
 #include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/string.hpp>
 #include <boost/serialization/unique_ptr.hpp>
 #include <boost/serialization/vector.hpp>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 
 #include <boost/archive/xml_iarchive.hpp>
 #include <boost/archive/xml_oarchive.hpp>
 
-#include "../Serialization.suffix.h"
+#include "SerializationTestObjs.h"
+
+#include <atomic>
+#include <string_view>
+#include <thread>
 
 template <typename T>
 using ComparisonFunc = void (*)(T const &, T const &);
@@ -138,16 +146,6 @@ TEST_CASE("EmptyObj") {
     TestImpl(EmptyObj());
 }
 
-struct SingleMemberObj {
-    int const a;
-
-    CONSTRUCTOR(SingleMemberObj, a);
-    NON_COPYABLE(SingleMemberObj);
-    MOVE(SingleMemberObj, a);
-    COMPARE(SingleMemberObj, a);
-    SERIALIZATION(SingleMemberObj, a);
-};
-
 TEST_CASE("SingleMemberObj") {
     TestImpl(SingleMemberObj(10));
 }
@@ -178,17 +176,6 @@ TEST_CASE("SingleMemberSingleBaseObj") {
     TestImpl(SingleMemberSingleBaseObj(10, true));
 }
 
-struct MultiMemberObj {
-    bool const b;
-    char const c;
-
-    CONSTRUCTOR(MultiMemberObj, MEMBERS(b, c));
-    NON_COPYABLE(MultiMemberObj);
-    MOVE(MultiMemberObj, MEMBERS(b, c));
-    COMPARE(MultiMemberObj, MEMBERS(b, c));
-    SERIALIZATION(MultiMemberObj, MEMBERS(b, c));
-};
-
 TEST_CASE("MultiMemberObj") {
     TestImpl(MultiMemberObj(true, 'c'));
 }
@@ -205,20 +192,38 @@ TEST_CASE("MultiBaseObj") {
     TestImpl(MultiBaseObj(10, true, 'c'));
 }
 
-struct MultiMemberMultiBaseObj : public SingleMemberObj, public MultiMemberObj {
-    double const d;
-    float const f;
-    std::unique_ptr<MultiMemberObj> const pMultiMember;
+TEST_CASE("MultiMemberMultiBaseObj") {
+    TestImpl(MultiMemberMultiBaseObj(10, true, 'c', 1.0, 2.0f, std::make_unique<MultiMemberObj>(true, 'q')));
+}
+
+TEST_CASE("FlatObj") {
+    TestImpl(FlatObj(10, 20.0, true, "thirty"));
+}
+
+TEST_CASE("VectorObj") {
+    TestImpl(
+        VectorObj(
+            CommonHelpers::Stl::CreateVector<FlatObj>(
+                FlatObj(10, 20.0, true, "thirty"),
+                FlatObj(40, 50.0, false, "sixty")
+            )
+        )
+    );
+}
+
+struct NestedObj {
+    MultiMemberMultiBaseObj const           obj;
+    SingleMemberObj const                   single;
 
-    CONSTRUCTOR(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj), FLAGS(CONSTRUCTOR_BASE_ARGS_1(2), CONSTRUCTOR_BASES_BEFORE_MEMBERS));
-    NON_COPYABLE(MultiMemberMultiBaseObj);
-    MOVE(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj));
-    COMPARE(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj));
-    SERIALIZATION(MultiMemberMultiBaseObj, MEMBERS(d, f, pMultiMember), BASES(SingleMemberObj, MultiMemberObj));
+    CONSTRUCTOR(NestedObj, obj, single);
+    NON_COPYABLE(NestedObj);
+    MOVE(NestedObj, obj, single);
+    COMPARE(NestedObj, obj, single);
+    SERIALIZATION(NestedObj, obj, single);
 };
 
-TEST_CASE("MultiMemberMultiBaseObj") {
-    TestImpl(MultiMemberMultiBaseObj(10, true, 'c', 1.0, 2.0f, std::make_unique<MultiMemberObj>(true, 'q')));
+TEST_CASE("NestedObj") {
+    TestImpl(NestedObj(MultiMemberMultiBaseObj(10, true, 'c', 1.0, 2.0f, std::make_unique<MultiMemberObj>(true, 'q')), SingleMemberObj(20)));
 }
 
 TEST_CASE("std::unique_ptr") {
@@ -260,92 +265,348 @@ TEST_CASE("std::vector") {
     StandardTestImpl(std::vector<std::shared_ptr<MultiMemberMultiBaseObj>>{ ptr, ptr, ptr }, Internal::Compare);
 }
 
-struct BaseObj {
+TEST_CASE("Polymorphic") {
+    PtrTestImpl<BaseObj>(Derived1Obj(10, true, 'c'));
+    PtrTestImpl<BaseObj>(Derived2Obj(10, true, 1.0));
+
+    // ----------------------------------------------------------------------
+    using BasePtr                           = std::shared_ptr<BaseObj>;
+    using Container                         = std::vector<BasePtr>;
+
+    struct Internal {
+        static void Compare(Container const &new_value, Container const &value) {
+            REQUIRE(std::dynamic_pointer_cast<Derived1Obj>(value[0]));
+            REQUIRE(std::dynamic_pointer_cast<Derived2Obj>(value[1]));
+            REQUIRE(std::dynamic_pointer_cast<Derived1Obj>(new_value[0]));
+            REQUIRE(std::dynamic_pointer_cast<Derived2Obj>(new_value[1]));
+
+            CHECK(CommonHelpers::Compare(std::static_pointer_cast<Derived1Obj>(new_value[0]), std::static_pointer_cast<Derived1Obj>(value[0])) == 0);
+            CHECK(CommonHelpers::Compare(std::static_pointer_cast<Derived2Obj>(new_value[1]), std::static_pointer_cast<Derived2Obj>(value[1])) == 0);
+        }
+    };
+    // ----------------------------------------------------------------------
+
+    StandardTestImpl(BasePtr(std::make_shared<Derived1Obj>(10, true, 'c')));
+    StandardTestImpl(Container{ BasePtr(std::make_shared<Derived1Obj>(10, true, 'c')), BasePtr(std::make_shared<Derived2Obj>(20, false, 2.0)) }, Internal::Compare);
+
+    // Empty objects
+    StandardTestImpl(std::unique_ptr<BaseObj>());
+    StandardTestImpl(std::shared_ptr<BaseObj>());
+    StandardTestImpl(Container{ BasePtr() });
+}
+
+TEST_CASE("Polymorphic - registration") {
+    Derived1Obj const                       obj(10, true, 'c');
+
+    // Types are registered by SERIALIZATION_POLYMORPHIC_DEFINE before main...
+    size_t const                            numRegistrations(BoostHelpers::Serialization::Details::GetNumTypeRegistrations().load());
+
+    CHECK(numRegistrations != 0);
+
+    // ...and not again when they are serialized
+    PtrTestImpl<BaseObj>(obj);
+    StandardTestImpl(std::unique_ptr<BaseObj>(std::make_unique<Derived1Obj>(20, false, 'd')));
+
+    CHECK(BoostHelpers::Serialization::Details::GetNumTypeRegistrations().load() == numRegistrations);
+}
+
+TEST_CASE("Polymorphic - concurrent") {
+    size_t const                            numRegistrations(BoostHelpers::Serialization::Details::GetNumTypeRegistrations().load());
+
+    // Catch's assertions aren't thread safe, so errors are counted and checked once all threads have completed
+    std::atomic<size_t>                     numErrors(0);
+    std::vector<std::thread>                threads;
+
+    for(int index = 0; index < 8; ++index) {
+        threads.emplace_back(
+            [index, &numErrors](void) {
+                for(int iteration = 0; iteration < 100; ++iteration) {
+                    Derived1Obj const                       obj(index, iteration % 2 == 0, 'c');
+                    std::ostringstream                      out;
+
+                    obj.SerializePtr<boost::archive::binary_oarchive>(out);
+
+                    std::istringstream                      in(out.str());
+                    std::unique_ptr<BaseObj> const          pOther(Derived1Obj::DeserializePtr<boost::archive::binary_iarchive>(in));
+
+                    if(CommonHelpers::Compare(static_cast<Derived1Obj const &>(*pOther), obj) != 0)
+                        ++numErrors;
+                }
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    CHECK(numErrors.load() == 0);
+    CHECK(BoostHelpers::Serialization::Details::GetNumTypeRegistrations().load() == numRegistrations);
+}
+
+struct TypeIdBaseObj {
     int const a;
 
-    CONSTRUCTOR(BaseObj, MEMBERS(a));
-    COMPARE(BaseObj, MEMBERS(a));
-    SERIALIZATION(BaseObj, MEMBERS(a), FLAGS(SERIALIZATION_ABSTRACT));
+    CONSTRUCTOR(TypeIdBaseObj, MEMBERS(a));
+    COMPARE(TypeIdBaseObj, MEMBERS(a));
+    SERIALIZATION(TypeIdBaseObj, MEMBERS(a), FLAGS(SERIALIZATION_ABSTRACT, SERIALIZATION_POLYMORPHIC_TYPE_IDS));
 
-    virtual ~BaseObj(void) = default;
+    virtual ~TypeIdBaseObj(void) = default;
     virtual void Method1(void) const = 0;
 };
 
-SERIALIZATION_POLYMORPHIC_DECLARE(BaseObj);
-SERIALIZATION_POLYMORPHIC_DEFINE(BaseObj);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(TypeIdBaseObj);
 
-struct AbstractObj : public BaseObj {
-    bool const b;
+struct TypeIdDerived1Obj : public TypeIdBaseObj {
+    char const c;
 
-    CONSTRUCTOR(AbstractObj, MEMBERS(b), BASES(BaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
-    NON_COPYABLE(AbstractObj);
-    NON_MOVABLE(AbstractObj);
-    COMPARE(AbstractObj, MEMBERS(b), BASES(BaseObj));
-    SERIALIZATION(AbstractObj, MEMBERS(b), BASES(BaseObj), FLAGS(SERIALIZATION_DATA_ONLY));
+    CONSTRUCTOR(TypeIdDerived1Obj, MEMBERS(c), BASES(TypeIdBaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    COMPARE(TypeIdDerived1Obj, MEMBERS(c), BASES(TypeIdBaseObj));
+    SERIALIZATION(TypeIdDerived1Obj, MEMBERS(c), BASES(TypeIdBaseObj), FLAGS(SERIALIZATION_POLYMORPHIC(TypeIdBaseObj)));
 
-    virtual ~AbstractObj(void) = default;
-    virtual void Method2(void) const = 0;
+    ~TypeIdDerived1Obj(void) override = default;
+
+    void Method1(void) const override {}
 };
 
-struct Derived1Obj : public AbstractObj {
-    char const c;
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_WITH_ID(TypeIdDerived1Obj, 1);
+
+struct TypeIdDerived2Obj : public TypeIdBaseObj {
+    std::string const s;
 
-    CONSTRUCTOR(Derived1Obj, MEMBERS(c), BASES(AbstractObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS, CONSTRUCTOR_BASE_ARGS_0(2)));
-    COMPARE(Derived1Obj, MEMBERS(c), BASES(AbstractObj));
-    SERIALIZATION(Derived1Obj, MEMBERS(c), BASES(AbstractObj), FLAGS(SERIALIZATION_POLYMORPHIC(BaseObj)));
+    CONSTRUCTOR(TypeIdDerived2Obj, MEMBERS(s), BASES(TypeIdBaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    COMPARE(TypeIdDerived2Obj, MEMBERS(s), BASES(TypeIdBaseObj));
+    SERIALIZATION(TypeIdDerived2Obj, MEMBERS(s), BASES(TypeIdBaseObj), FLAGS(SERIALIZATION_POLYMORPHIC(TypeIdBaseObj)));
 
-    ~Derived1Obj(void) override = default;
+    ~TypeIdDerived2Obj(void) override = default;
 
     void Method1(void) const override {}
-    void Method2(void) const override {}
 };
 
-SERIALIZATION_POLYMORPHIC_DECLARE(Derived1Obj);
-SERIALIZATION_POLYMORPHIC_DEFINE(Derived1Obj);
+// Ids >= 128 require multiple bytes in binary archives
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE_WITH_ID(TypeIdDerived2Obj, 200);
 
-struct Derived2Obj : public AbstractObj {
-    double const d;
+TEST_CASE("Polymorphic - type ids") {
+    PtrTestImpl<TypeIdBaseObj>(TypeIdDerived1Obj(10, 'c'));
+    PtrTestImpl<TypeIdBaseObj>(TypeIdDerived2Obj(20, "two"));
+    PtrTestImplArchive<TypeIdBaseObj, boost::archive::binary_oarchive, boost::archive::binary_iarchive>(TypeIdDerived1Obj(10, 'c'));
+    PtrTestImplArchive<TypeIdBaseObj, boost::archive::binary_oarchive, boost::archive::binary_iarchive>(TypeIdDerived2Obj(20, "two"));
+
+    // Objects serialized as members continue to use boost's class names
+    StandardTestImpl(std::unique_ptr<TypeIdBaseObj>(std::make_unique<TypeIdDerived1Obj>(30, 'd')));
+
+    // The binary output only contains the id and the data
+    std::ostringstream                      header;
+
+    {
+        boost::archive::binary_oarchive     ar(header);
+    }
+
+    std::ostringstream                      out;
+
+    TypeIdDerived1Obj(10, 'c').SerializePtr<boost::archive::binary_oarchive>(out);
+    CHECK(out.str().size() == header.str().size() + 1 + sizeof(int) + sizeof(char));
+    CHECK(out.str().find("TypeIdDerived1Obj") == std::string::npos);
+
+    out.str("");
+
+    TypeIdDerived2Obj(20, "two").SerializePtr<boost::archive::binary_oarchive>(out);
+    CHECK(out.str().find("TypeIdDerived2Obj") == std::string::npos);
+
+    // Ids that haven't been registered
+    {
+        std::ostringstream                  invalid;
+
+        {
+            boost::archive::binary_oarchive ar(invalid);
+            unsigned char const             id(5);
+
+            ar.save_binary(&id, 1);
+        }
+
+        std::istringstream                  in(invalid.str());
+
+        CHECK_THROWS_AS(TypeIdBaseObj::DeserializePtr<boost::archive::binary_iarchive>(in), std::runtime_error);
+    }
+
+    {
+        std::ostringstream                  invalid;
+
+        {
+            boost::archive::text_oarchive   ar(invalid);
+            std::uint32_t const             id(1000);
+
+            ar << id;
+        }
+
+        std::istringstream                  in(invalid.str());
+
+        CHECK_THROWS_AS(TypeIdBaseObj::DeserializePtr<boost::archive::text_iarchive>(in), std::runtime_error);
+    }
+}
+
+#if (defined __cpp_lib_memory_resource)
+
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+    size_t                                  numAllocations = 0;
+    size_t                                  numOutstanding = 0;
+
+private:
+    std::pmr::monotonic_buffer_resource     _buffer;
+
+    void * do_allocate(size_t cBytes, size_t alignment) override {
+        ++numAllocations;
+        ++numOutstanding;
+
+        return _buffer.allocate(cBytes, alignment);
+    }
+
+    void do_deallocate(void *pMemory, size_t cBytes, size_t alignment) override {
+        --numOutstanding;
+        _buffer.deallocate(pMemory, cBytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+template <typename OArchiveT, typename IArchiveT, typename T>
+void ArenaPtrTestImplArchive(T const &value) {
+    std::ostringstream                      out;
+
+    value.template SerializePtr<OArchiveT>(out);
+    out.flush();
+
+    std::string                             result(out.str());
+
+    UNSCOPED_INFO(result);
+
+    CountingMemoryResource                  resource;
 
-    CONSTRUCTOR(Derived2Obj, MEMBERS(d), BASES(AbstractObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS, CONSTRUCTOR_BASE_ARGS_0(2)));
-    COMPARE(Derived2Obj, MEMBERS(d), BASES(AbstractObj));
-    SERIALIZATION(Derived2Obj, MEMBERS(d), BASES(AbstractObj), FLAGS(SERIALIZATION_POLYMORPHIC(BaseObj)));
+    {
+        std::istringstream                  in(result);
+        BoostHelpers::Serialization::ArenaUniquePtr<BaseObj> const          other(BaseObj::DeserializePtr<IArchiveT>(in, resource));
 
-    ~Derived2Obj(void) override = default;
+        REQUIRE(dynamic_cast<T const *>(other.get()));
+        CHECK(CommonHelpers::Compare(static_cast<T const &>(*other), value) == 0);
+
+        // The SerializationPOD and the object
+        CHECK(resource.numAllocations == 2);
+        CHECK(resource.numOutstanding == 1);
+    }
+
+    CHECK(resource.numOutstanding == 0);
+}
+
+TEST_CASE("Polymorphic - memory resource") {
+    ArenaPtrTestImplArchive<boost::archive::text_oarchive, boost::archive::text_iarchive>(Derived1Obj(10, true, 'c'));
+    ArenaPtrTestImplArchive<boost::archive::xml_oarchive, boost::archive::xml_iarchive>(Derived1Obj(10, true, 'c'));
+    ArenaPtrTestImplArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(Derived2Obj(10, true, 1.0));
+
+    // Objects deserialized without a memory resource are not affected
+    PtrTestImpl<BaseObj>(Derived2Obj(20, false, 2.0));
+}
+
+/// Counts the number of live instances, so that tests can verify that partially
+/// deserialized objects are destroyed.
+struct LiveCountedValue {
+    static inline int                       numLive = 0;
+
+    int                                     value = 0;
+
+    LiveCountedValue(void) { ++numLive; }
+    explicit LiveCountedValue(int v) : value(v) { ++numLive; }
+    LiveCountedValue(LiveCountedValue const &other) : value(other.value) { ++numLive; }
+    ~LiveCountedValue(void) { --numLive; }
+
+    LiveCountedValue & operator =(LiveCountedValue const &) = default;
+
+    template <typename ArchiveT>
+    void serialize(ArchiveT &ar, unsigned int const) {
+        ar & boost::serialization::make_nvp("value", value);
+    }
+};
+
+struct ArenaMembersObj : public AbstractObj {
+    std::string const                       name;
+    std::vector<LiveCountedValue> const     values;
+
+    CONSTRUCTOR(ArenaMembersObj, MEMBERS(name, values), BASES(AbstractObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS, CONSTRUCTOR_BASE_ARGS_0(2)));
+    SERIALIZATION(ArenaMembersObj, MEMBERS(name, values), BASES(AbstractObj), FLAGS(SERIALIZATION_POLYMORPHIC(BaseObj)));
+
+    ~ArenaMembersObj(void) override = default;
 
     void Method1(void) const override {}
     void Method2(void) const override {}
 };
 
-SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Derived2Obj);
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(ArenaMembersObj);
 
-TEST_CASE("Polymorphic") {
-    PtrTestImpl<BaseObj>(Derived1Obj(10, true, 'c'));
-    PtrTestImpl<BaseObj>(Derived2Obj(10, true, 1.0));
+TEST_CASE("Polymorphic - memory resource, load throws") {
+    std::ostringstream                      out;
 
-    // ----------------------------------------------------------------------
-    using BasePtr                           = std::shared_ptr<BaseObj>;
-    using Container                         = std::vector<BasePtr>;
+    Derived2Obj(10, true, 1.0).SerializePtr<boost::archive::binary_oarchive>(out);
+    out.flush();
 
-    struct Internal {
-        static void Compare(Container const &new_value, Container const &value) {
-            REQUIRE(std::dynamic_pointer_cast<Derived1Obj>(value[0]));
-            REQUIRE(std::dynamic_pointer_cast<Derived2Obj>(value[1]));
-            REQUIRE(std::dynamic_pointer_cast<Derived1Obj>(new_value[0]));
-            REQUIRE(std::dynamic_pointer_cast<Derived2Obj>(new_value[1]));
+    // Truncate the archive so that the load fails after the SerializationPOD has been created
+    std::string                             result(out.str());
 
-            CHECK(CommonHelpers::Compare(std::static_pointer_cast<Derived1Obj>(new_value[0]), std::static_pointer_cast<Derived1Obj>(value[0])) == 0);
-            CHECK(CommonHelpers::Compare(std::static_pointer_cast<Derived2Obj>(new_value[1]), std::static_pointer_cast<Derived2Obj>(value[1])) == 0);
-        }
-    };
-    // ----------------------------------------------------------------------
+    result.resize(result.size() - 4);
 
-    StandardTestImpl(BasePtr(std::make_shared<Derived1Obj>(10, true, 'c')));
-    StandardTestImpl(Container{ BasePtr(std::make_shared<Derived1Obj>(10, true, 'c')), BasePtr(std::make_shared<Derived2Obj>(20, false, 2.0)) }, Internal::Compare);
+    CountingMemoryResource                  resource;
+    std::istringstream                      in(result);
 
-    // Empty objects
-    StandardTestImpl(std::unique_ptr<BaseObj>());
-    StandardTestImpl(std::shared_ptr<BaseObj>());
-    StandardTestImpl(Container{ BasePtr() });
+    CHECK_THROWS_AS(BaseObj::DeserializePtr<boost::archive::binary_iarchive>(in, resource), boost::archive::archive_exception);
+
+    // The partially loaded SerializationPOD is returned to the resource
+    CHECK(resource.numAllocations == 1);
+    CHECK(resource.numOutstanding == 0);
+
+    SECTION("Partially loaded members") {
+        std::ostringstream                  membersOut;
+
+        ArenaMembersObj(10, true, std::string(100, 'n'), std::vector<LiveCountedValue>(10, LiveCountedValue(3))).SerializePtr<boost::archive::binary_oarchive>(membersOut);
+        membersOut.flush();
+
+        REQUIRE(LiveCountedValue::numLive == 0);
+
+        // Truncate the archive in the middle of the vector, after the string has been loaded
+        std::string                         membersResult(membersOut.str());
+
+        membersResult.resize(membersResult.size() - 2 * sizeof(int));
+
+        CountingMemoryResource              membersResource;
+        std::istringstream                  membersIn(membersResult);
+
+        CHECK_THROWS_AS(BaseObj::DeserializePtr<boost::archive::binary_iarchive>(membersIn, membersResource), boost::archive::archive_exception);
+
+        // The SerializationPOD (along with the string and vector that it was loading) is destroyed
+        // before its memory is returned to the resource
+        CHECK(membersResource.numAllocations == 1);
+        CHECK(membersResource.numOutstanding == 0);
+        CHECK(LiveCountedValue::numLive == 0);
+    }
+}
+
+#endif
+
+TEST_CASE("SerializationPOD layout") {
+    // Objects are saved via a view of the object and are only polymorphic
+    // when they are serialized via a pointer to a base class.
+    CHECK(sizeof(MultiMemberObj::SerializationPOD::SerializeData) == sizeof(void *));
+    CHECK(sizeof(MultiMemberMultiBaseObj::SerializationPOD::SerializeData) == sizeof(void *));
+    CHECK(std::is_trivially_destructible_v<MultiMemberObj::SerializationPOD::SerializeData>);
+    CHECK(std::is_trivially_destructible_v<MultiMemberMultiBaseObj::SerializationPOD::SerializeData>);
+
+    CHECK(std::is_polymorphic_v<MultiMemberObj::SerializationPOD> == false);
+    CHECK(std::is_polymorphic_v<MultiMemberMultiBaseObj::SerializationPOD> == false);
+    CHECK(std::is_polymorphic_v<MultiMemberMultiBaseObj::SerializationPOD::SerializeData> == false);
+    CHECK(std::is_polymorphic_v<MultiMemberMultiBaseObj::SerializationPOD::DeserializeData> == false);
+
+    CHECK(std::is_polymorphic_v<BaseObj::SerializationPOD>);
+    CHECK(std::is_polymorphic_v<Derived1Obj::SerializationPOD>);
+    CHECK(std::is_polymorphic_v<Derived1Obj::SerializationPOD::SerializeData> == false);
 }
 
 struct DataCustomConstructorObj {
@@ -432,87 +693,493 @@ TEST_CASE("CustomTypesObj") {
     TestImpl(CustomTypesObj(static_cast<unsigned char>(10), static_cast<unsigned char>(20)));
 }
 
-class EventObj {
-public:
-    int const a;
-    bool const b;
-
-    unsigned long ulConstructCtr = 0;
-    unsigned long ulDeserializeConstructCtr = 0;
-
-    CONSTRUCTOR(EventObj, a, b);
-    COMPARE(EventObj, a, b);
-    SERIALIZATION(EventObj, a, b);
+struct BitwiseObj {
+    double const d;
+    int const i;
+    char const c;
 
-private:
-    friend class CommonHelpers::TypeTraits::Access;
+    CONSTRUCTOR(BitwiseObj, d, i, c);
+    NON_COPYABLE(BitwiseObj);
+    MOVE(BitwiseObj, d, i, c);
+    COMPARE(BitwiseObj, d, i, c);
+    SERIALIZATION(BitwiseObj, MEMBERS(d, i, c), FLAGS(SERIALIZATION_DATA_BITWISE));
+};
 
-    void DeserializeFinalConstruct(void) {
-        ++ulDeserializeConstructCtr;
-    }
+struct NonBitwiseObj {
+    double const d;
+    int const i;
+    char const c;
 
-    void FinalConstruct(void) {
-        ++ulConstructCtr;
-    }
+    CONSTRUCTOR(NonBitwiseObj, d, i, c);
+    NON_COPYABLE(NonBitwiseObj);
+    MOVE(NonBitwiseObj, d, i, c);
+    COMPARE(NonBitwiseObj, d, i, c);
+    SERIALIZATION(NonBitwiseObj, MEMBERS(d, i, c));
 };
 
-TEST_CASE("EventObj") {
-    // ----------------------------------------------------------------------
-    struct Internal {
-        static void Compare(EventObj const &new_value, EventObj const &value) {
-            CHECK(value.ulConstructCtr == 1);
-            CHECK(value.ulDeserializeConstructCtr == 0);
-            CHECK(new_value.ulConstructCtr == 1);
-            CHECK(new_value.ulDeserializeConstructCtr == 1);
-        }
-    };
-    // ----------------------------------------------------------------------
+TEST_CASE("BitwiseObj") {
+    TestImpl(BitwiseObj(1.0, 2, 'c'));
+    TestImplArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(BitwiseObj(1.0, 2, 'c'));
 
-    TestImpl(EventObj(10, true), Internal::Compare);
-}
+    // The bitwise output should be the same as the output generated member-by-member
+    std::ostringstream                      bitwiseOut;
+    std::ostringstream                      nonBitwiseOut;
 
-TEST_CASE("GetSerializedSize") {
-    EventObj const                          obj(10, true);
-    size_t const                            value1(obj.GetSerializedSize<boost::archive::text_oarchive>());
-    size_t const                            value2(obj.GetSerializedSize<boost::archive::xml_oarchive>());
+    BitwiseObj(1.0, 2, 'c').Serialize<boost::archive::binary_oarchive>(bitwiseOut);
+    NonBitwiseObj(1.0, 2, 'c').Serialize<boost::archive::binary_oarchive>(nonBitwiseOut);
 
-    CHECK(value1 != 0);
-    CHECK(value2 != 0);
-    CHECK(value1 != value2);
+    CHECK(bitwiseOut.str() == nonBitwiseOut.str());
 }
 
-TEST_CASE("GetSerializedPtrSize") {
-    Derived1Obj const                       obj(10, true, 'c');
-    size_t const                            value1(obj.GetSerializedPtrSize<boost::archive::text_oarchive>());
-    size_t const                            value2(obj.GetSerializedPtrSize<boost::archive::xml_oarchive>());
+enum class SmallEnum : std::uint8_t {
+    Zero,
+    One,
+    Two
+};
 
-    CHECK(value1 != 0);
-    CHECK(value2 != 0);
-    CHECK(value1 != value2);
-}
+struct BitwiseEnumObj {
+    SmallEnum const e;
+    short const s;
 
-struct AdditionalVoidCastBase {
-public:
-    int const                               a;
+    CONSTRUCTOR(BitwiseEnumObj, e, s);
+    SERIALIZATION(BitwiseEnumObj, MEMBERS(e, s), FLAGS(SERIALIZATION_DATA_BITWISE));
+};
 
-    CONSTRUCTOR(AdditionalVoidCastBase, a);
-    virtual ~AdditionalVoidCastBase(void) = default;
+struct NonBitwiseEnumObj {
+    SmallEnum const e;
+    short const s;
 
-    COMPARE(AdditionalVoidCastBase, a);
-    SERIALIZATION(AdditionalVoidCastBase, MEMBERS(a), FLAGS(SERIALIZATION_POLYMORPHIC_BASE));
+    CONSTRUCTOR(NonBitwiseEnumObj, e, s);
+    SERIALIZATION(NonBitwiseEnumObj, MEMBERS(e, s));
 };
 
-struct AdditionalVoidCastDerivedData : public AdditionalVoidCastBase {
-    bool const                              b;
+TEST_CASE("BitwiseEnumObj") {
+    // Enums are written as ints, as they are when serialized member-by-member
+    std::ostringstream                      bitwiseOut;
+    std::ostringstream                      nonBitwiseOut;
 
-    CONSTRUCTOR(AdditionalVoidCastDerivedData, MEMBERS(b), BASES(AdditionalVoidCastBase));
-    ~AdditionalVoidCastDerivedData(void) override = default;
+    BitwiseEnumObj(SmallEnum::Two, 3).Serialize<boost::archive::binary_oarchive>(bitwiseOut);
+    NonBitwiseEnumObj(SmallEnum::Two, 3).Serialize<boost::archive::binary_oarchive>(nonBitwiseOut);
 
-    COMPARE(AdditionalVoidCastDerivedData, MEMBERS(b), BASES(AdditionalVoidCastBase));
-    SERIALIZATION(AdditionalVoidCastDerivedData, MEMBERS(b), BASES(AdditionalVoidCastBase), FLAGS(SERIALIZATION_DATA_ONLY));
+    CHECK(bitwiseOut.str() == nonBitwiseOut.str());
+    CHECK(BitwiseEnumObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == sizeof(int) + sizeof(short));
 
-    virtual void Method(void) = 0;
-};
+    std::istringstream                      in(nonBitwiseOut.str());
+    BitwiseEnumObj const                    other(BitwiseEnumObj::Deserialize<boost::archive::binary_iarchive>(in));
+
+    CHECK(other.e == SmallEnum::Two);
+    CHECK(other.s == 3);
+}
+
+struct BitwiseCollectionObj {
+    std::int64_t l;
+    std::int32_t i;
+    std::int32_t j;
+
+    BitwiseCollectionObj(void) = default;
+    CONSTRUCTOR(BitwiseCollectionObj, l, i, j);
+    COMPARE(BitwiseCollectionObj, l, i, j);
+    SERIALIZATION(BitwiseCollectionObj, MEMBERS(l, i, j), FLAGS(SERIALIZATION_DATA_BITWISE));
+};
+
+SERIALIZATION_BITWISE_DECLARE(BitwiseCollectionObj);
+
+TEST_CASE("BitwiseCollectionObj") {
+    CHECK(boost::serialization::is_bitwise_serializable<BitwiseCollectionObj>::value);
+
+    std::vector<BitwiseCollectionObj> const values{ BitwiseCollectionObj(1, 2, 3), BitwiseCollectionObj(4, 5, 6), BitwiseCollectionObj(7, 8, 9) };
+
+    TestImpl(BitwiseCollectionObj(1, 2, 3));
+    StandardTestImpl(values);
+    StandardTestImplArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(values);
+    StandardTestImpl(std::make_shared<BitwiseCollectionObj>(10, 11, 12));
+}
+
+struct BitwiseDoubleCollectionObj {
+    double bid;
+    double ask;
+    double last;
+
+    BitwiseDoubleCollectionObj(void) = default;
+    CONSTRUCTOR(BitwiseDoubleCollectionObj, bid, ask, last);
+    COMPARE(BitwiseDoubleCollectionObj, bid, ask, last);
+    SERIALIZATION(BitwiseDoubleCollectionObj, MEMBERS(bid, ask, last), FLAGS(SERIALIZATION_DATA_BITWISE));
+};
+
+SERIALIZATION_BITWISE_DECLARE(BitwiseDoubleCollectionObj);
+
+TEST_CASE("BitwiseCollectionObj - floating point") {
+    CHECK(boost::serialization::is_bitwise_serializable<BitwiseDoubleCollectionObj>::value);
+
+    std::vector<BitwiseDoubleCollectionObj> const values{ BitwiseDoubleCollectionObj(1.5, 2.25, -3.0), BitwiseDoubleCollectionObj(4.5, 5.75, 6.125) };
+
+    TestImpl(BitwiseDoubleCollectionObj(1.5, 2.25, -3.0));
+    StandardTestImpl(values);
+    StandardTestImplArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(values);
+}
+
+struct VersionedV1Obj {
+    int const a;
+
+    CONSTRUCTOR(VersionedV1Obj, a);
+    NON_COPYABLE(VersionedV1Obj);
+    MOVE(VersionedV1Obj, a);
+    COMPARE(VersionedV1Obj, a);
+    SERIALIZATION(VersionedV1Obj, MEMBERS(a), FLAGS(SERIALIZATION_VERSION(1)));
+};
+
+struct VersionedV2Obj {
+    int const a;
+    int const b;
+    std::string const s;
+
+    CONSTRUCTOR(VersionedV2Obj, a, b, s);
+    NON_COPYABLE(VersionedV2Obj);
+    MOVE(VersionedV2Obj, a, b, s);
+    COMPARE(VersionedV2Obj, a, b, s);
+    SERIALIZATION(VersionedV2Obj, MEMBERS(a, b, s), FLAGS(SERIALIZATION_VERSION(2), SERIALIZATION_MEMBERS_SINCE((b, 2, 42), (s, 2))));
+};
+
+struct UnversionedV2Obj {
+    int const a;
+    int const b;
+    std::string const s;
+
+    CONSTRUCTOR(UnversionedV2Obj, a, b, s);
+    NON_COPYABLE(UnversionedV2Obj);
+    MOVE(UnversionedV2Obj, a, b, s);
+    COMPARE(UnversionedV2Obj, a, b, s);
+    SERIALIZATION(UnversionedV2Obj, a, b, s);
+};
+
+template <typename OArchiveT, typename IArchiveT>
+void VersionedTestImpl(void) {
+    TestImplArchive<OArchiveT, IArchiveT>(VersionedV1Obj(10));
+    TestImplArchive<OArchiveT, IArchiveT>(VersionedV2Obj(10, 20, "thirty"));
+
+    // Older archive, newer type
+    {
+        std::ostringstream                  out;
+
+        VersionedV1Obj(10).template Serialize<OArchiveT>(out);
+        out.flush();
+
+        std::string const                   result(out.str());
+
+        UNSCOPED_INFO(result);
+
+        std::istringstream                  in(result);
+        VersionedV2Obj const                other(VersionedV2Obj::template Deserialize<IArchiveT>(in));
+
+        CHECK(other.a == 10);
+        CHECK(other.b == 42);
+        CHECK(other.s.empty());
+    }
+
+    // Newer archive, older type
+    {
+        std::ostringstream                  out;
+
+        VersionedV2Obj(10, 20, "thirty").template Serialize<OArchiveT>(out);
+        out.flush();
+
+        std::istringstream                  in(out.str());
+
+        CHECK_THROWS_AS(VersionedV1Obj::template Deserialize<IArchiveT>(in), std::runtime_error);
+    }
+}
+
+template <typename T>
+size_t GetBinarySize(size_t num_objs) {
+    std::ostringstream                      out;
+
+    {
+        boost::archive::binary_oarchive     ar(out);
+
+        for(size_t index = 0; index < num_objs; ++index)
+            T(static_cast<int>(index), 2, "three").Serialize(ar);
+    }
+
+    return out.str().size();
+}
+
+TEST_CASE("Versioned") {
+    static_assert(VersionedV1Obj::SerializationSchema::Version == 1);
+    static_assert(VersionedV2Obj::SerializationSchema::Version == 2);
+    static_assert(UnversionedV2Obj::SerializationSchema::Version == 0);
+
+    VersionedTestImpl<boost::archive::text_oarchive, boost::archive::text_iarchive>();
+    VersionedTestImpl<boost::archive::xml_oarchive, boost::archive::xml_iarchive>();
+    VersionedTestImpl<boost::archive::binary_oarchive, boost::archive::binary_iarchive>();
+
+    // The version is written once per archive rather than with each object
+    CHECK(GetBinarySize<VersionedV2Obj>(3) - GetBinarySize<VersionedV2Obj>(1) == GetBinarySize<UnversionedV2Obj>(3) - GetBinarySize<UnversionedV2Obj>(1));
+    CHECK(GetBinarySize<VersionedV2Obj>(1) > GetBinarySize<UnversionedV2Obj>(1));
+}
+
+struct LookupTableObj {
+    std::vector<int> const values;
+
+    CONSTRUCTOR(LookupTableObj, values);
+    NON_COPYABLE(LookupTableObj);
+    MOVE(LookupTableObj, values);
+    COMPARE(LookupTableObj, values);
+    SERIALIZATION(LookupTableObj, values);
+};
+
+struct ConfigNodeObj {
+    int const id;
+    std::shared_ptr<LookupTableObj> const pTable;
+    std::shared_ptr<BaseObj> const pBase;
+
+    CONSTRUCTOR(ConfigNodeObj, id, pTable, pBase);
+    NON_COPYABLE(ConfigNodeObj);
+    MOVE(ConfigNodeObj, id, pTable, pBase);
+    COMPARE(ConfigNodeObj, id, pTable, pBase);
+    SERIALIZATION(ConfigNodeObj, id, pTable, pBase);
+};
+
+template <typename OArchiveT, typename IArchiveT>
+std::string SharedMembersTestImpl(bool share_objects) {
+    std::shared_ptr<LookupTableObj> const   pTable(std::make_shared<LookupTableObj>(std::vector<int>(1000, 1)));
+    std::shared_ptr<BaseObj> const          pBase(std::make_shared<Derived1Obj>(10, true, 'c'));
+    std::vector<ConfigNodeObj>              nodes;
+
+    for(int index = 0; index < 100; ++index) {
+        if(share_objects)
+            nodes.emplace_back(index, pTable, pBase);
+        else
+            nodes.emplace_back(index, std::make_shared<LookupTableObj>(pTable->values), std::make_shared<Derived1Obj>(10, true, 'c'));
+    }
+
+    std::ostringstream                      out;
+
+    {
+        OArchiveT                           ar(out);
+
+        for(ConfigNodeObj const &node : nodes)
+            node.Serialize(ar);
+    }
+
+    std::string                             result(out.str());
+    std::istringstream                      in(result);
+    IArchiveT                               ar(in);
+    std::vector<ConfigNodeObj>              other;
+
+    for(size_t index = 0; index < nodes.size(); ++index)
+        other.emplace_back(ConfigNodeObj::Deserialize(ar));
+
+    CHECK(CommonHelpers::Compare(other, nodes) == 0);
+
+    for(size_t index = 1; index < other.size(); ++index) {
+        CHECK((other[index].pTable == other.front().pTable) == share_objects);
+        CHECK((other[index].pBase == other.front().pBase) == share_objects);
+    }
+
+    return result;
+}
+
+TEST_CASE("Shared members") {
+    SharedMembersTestImpl<boost::archive::text_oarchive, boost::archive::text_iarchive>(true);
+    SharedMembersTestImpl<boost::archive::text_oarchive, boost::archive::text_iarchive>(false);
+    SharedMembersTestImpl<boost::archive::xml_oarchive, boost::archive::xml_iarchive>(true);
+    SharedMembersTestImpl<boost::archive::xml_oarchive, boost::archive::xml_iarchive>(false);
+
+    // Objects referenced by multiple pointers are only written once
+    std::string const                       shared(SharedMembersTestImpl<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(true));
+    std::string const                       unshared(SharedMembersTestImpl<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(false));
+
+    CHECK(shared.size() < 1000 * sizeof(int) * 2);
+    CHECK(unshared.size() > 1000 * sizeof(int) * 100);
+}
+
+class EventObj {
+public:
+    int const a;
+    bool const b;
+
+    unsigned long ulConstructCtr = 0;
+    unsigned long ulDeserializeConstructCtr = 0;
+
+    CONSTRUCTOR(EventObj, a, b);
+    COMPARE(EventObj, a, b);
+    SERIALIZATION(EventObj, a, b);
+
+private:
+    friend class CommonHelpers::TypeTraits::Access;
+
+    void DeserializeFinalConstruct(void) {
+        ++ulDeserializeConstructCtr;
+    }
+
+    void FinalConstruct(void) {
+        ++ulConstructCtr;
+    }
+};
+
+TEST_CASE("EventObj") {
+    // ----------------------------------------------------------------------
+    struct Internal {
+        static void Compare(EventObj const &new_value, EventObj const &value) {
+            CHECK(value.ulConstructCtr == 1);
+            CHECK(value.ulDeserializeConstructCtr == 0);
+            CHECK(new_value.ulConstructCtr == 1);
+            CHECK(new_value.ulDeserializeConstructCtr == 1);
+        }
+    };
+    // ----------------------------------------------------------------------
+
+    TestImpl(EventObj(10, true), Internal::Compare);
+}
+
+TEST_CASE("GetSerializedSize") {
+    EventObj const                          obj(10, true);
+    size_t const                            value1(obj.GetSerializedSize<boost::archive::text_oarchive>());
+    size_t const                            value2(obj.GetSerializedSize<boost::archive::xml_oarchive>());
+
+    CHECK(value1 != 0);
+    CHECK(value2 != 0);
+    CHECK(value1 != value2);
+}
+
+TEST_CASE("GetSerializedPtrSize") {
+    Derived1Obj const                       obj(10, true, 'c');
+    size_t const                            value1(obj.GetSerializedPtrSize<boost::archive::text_oarchive>());
+    size_t const                            value2(obj.GetSerializedPtrSize<boost::archive::xml_oarchive>());
+
+    CHECK(value1 != 0);
+    CHECK(value2 != 0);
+    CHECK(value1 != value2);
+}
+
+template <typename OArchiveT, typename T>
+size_t GetActualSerializedSize(T const &value) {
+    std::ostringstream                      out;
+
+    value.template Serialize<OArchiveT>(out);
+    out.flush();
+
+    return out.str().size();
+}
+
+struct FixedSizeObj {
+    enum class Value {
+        Zero,
+        One,
+        Two
+    };
+
+    Value const e;
+    BitwiseCollectionObj const nested;
+    unsigned short const us;
+
+    CONSTRUCTOR(FixedSizeObj, e, nested, us);
+    SERIALIZATION(FixedSizeObj, MEMBERS(e, nested, us));
+};
+
+TEST_CASE("SerializedSizeUpperBound") {
+    using Unbounded                         = std::integral_constant<size_t, BoostHelpers::Serialization::Details::UnboundedSerializedSize>;
+
+    CHECK(EmptyObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == 0);
+    CHECK(EventObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == sizeof(int) + sizeof(bool));
+    CHECK(MultiBaseObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == sizeof(int) + sizeof(bool) + sizeof(char));
+    CHECK(BitwiseObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == sizeof(double) + sizeof(int) + sizeof(char));
+    CHECK(FixedSizeObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == sizeof(int) + sizeof(std::int64_t) + sizeof(std::int32_t) + sizeof(std::int32_t) + sizeof(unsigned short));
+
+    // Archives that don't write raw bytes and types with variable-length members
+    // don't have a compile-time size.
+    CHECK(EventObj::SerializedSizeUpperBound<boost::archive::text_oarchive> == Unbounded::value);
+    CHECK(EventObj::SerializedSizeUpperBound<boost::archive::xml_oarchive> == Unbounded::value);
+    CHECK(MultiMemberMultiBaseObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == Unbounded::value);
+    CHECK(CustomTypesObj::SerializedSizeUpperBound<boost::archive::binary_oarchive> == Unbounded::value);
+}
+
+TEST_CASE("GetSerializedSize - binary") {
+    CHECK(EmptyObj().GetSerializedSize<boost::archive::binary_oarchive>() == GetActualSerializedSize<boost::archive::binary_oarchive>(EmptyObj()));
+    CHECK(EventObj(10, true).GetSerializedSize<boost::archive::binary_oarchive>() == GetActualSerializedSize<boost::archive::binary_oarchive>(EventObj(10, true)));
+    CHECK(MultiBaseObj(10, true, 'c').GetSerializedSize<boost::archive::binary_oarchive>() == GetActualSerializedSize<boost::archive::binary_oarchive>(MultiBaseObj(10, true, 'c')));
+    CHECK(BitwiseObj(1.0, 2, 'c').GetSerializedSize<boost::archive::binary_oarchive>() == GetActualSerializedSize<boost::archive::binary_oarchive>(BitwiseObj(1.0, 2, 'c')));
+
+    FixedSizeObj const                      fixed(FixedSizeObj::Value::Two, BitwiseCollectionObj(1, 2, 3), 3);
+
+    CHECK(fixed.GetSerializedSize<boost::archive::binary_oarchive>() == GetActualSerializedSize<boost::archive::binary_oarchive>(fixed));
+
+    // Calculated by serializing the object
+    MultiMemberMultiBaseObj const           obj(10, true, 'c', 1.0, 2.0f, std::make_unique<MultiMemberObj>(true, 'q'));
+
+    CHECK(obj.GetSerializedSize<boost::archive::binary_oarchive>() == GetActualSerializedSize<boost::archive::binary_oarchive>(obj));
+    CHECK(obj.GetSerializedSize<boost::archive::text_oarchive>() == GetActualSerializedSize<boost::archive::text_oarchive>(obj));
+    CHECK(obj.GetSerializedSize<boost::archive::xml_oarchive>() == GetActualSerializedSize<boost::archive::xml_oarchive>(obj));
+}
+
+TEST_CASE("FixedSizeObj") {
+    FixedSizeObj const                      value(FixedSizeObj::Value::Two, BitwiseCollectionObj(1, 2, 3), 3);
+    std::ostringstream                      out;
+
+    value.Serialize<boost::archive::binary_oarchive>(out);
+    out.flush();
+
+    std::istringstream                      in(out.str());
+    FixedSizeObj const                      other(FixedSizeObj::Deserialize<boost::archive::binary_iarchive>(in));
+
+    CHECK(other.e == value.e);
+    CHECK(CommonHelpers::Compare(other.nested, value.nested) == 0);
+    CHECK(other.us == value.us);
+}
+
+#if (defined __cpp_lib_span)
+
+template <typename OArchiveT, typename IArchiveT, typename T>
+void SpanTestImplArchive(T const &value) {
+    std::vector<std::byte>                  buffer(value.template GetSerializedSize<OArchiveT>() + 10);
+    size_t const                            result(value.template Serialize<OArchiveT>(buffer));
+
+    CHECK(result == value.template GetSerializedSize<OArchiveT>());
+    CHECK(result == GetActualSerializedSize<OArchiveT>(value));
+
+    T const                                 other(T::template Deserialize<IArchiveT>(std::span<std::byte const>(buffer.data(), result)));
+
+    CHECK(CommonHelpers::Compare(other, value) == 0);
+
+    // Buffer is too small
+    std::vector<std::byte>                  small_buffer(result - 1);
+
+    CHECK_THROWS_AS(value.template Serialize<OArchiveT>(small_buffer), std::length_error);
+}
+
+TEST_CASE("Serialize to span") {
+    MultiMemberMultiBaseObj const           obj(10, true, 'c', 1.0, 2.0f, std::make_unique<MultiMemberObj>(true, 'q'));
+
+    SpanTestImplArchive<boost::archive::text_oarchive, boost::archive::text_iarchive>(obj);
+    SpanTestImplArchive<boost::archive::xml_oarchive, boost::archive::xml_iarchive>(obj);
+    SpanTestImplArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(obj);
+    SpanTestImplArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(BitwiseObj(1.0, 2, 'c'));
+}
+
+#endif
+
+struct AdditionalVoidCastBase {
+public:
+    int const                               a;
+
+    CONSTRUCTOR(AdditionalVoidCastBase, a);
+    virtual ~AdditionalVoidCastBase(void) = default;
+
+    COMPARE(AdditionalVoidCastBase, a);
+    SERIALIZATION(AdditionalVoidCastBase, MEMBERS(a), FLAGS(SERIALIZATION_POLYMORPHIC_BASE));
+};
+
+struct AdditionalVoidCastDerivedData : public AdditionalVoidCastBase {
+    bool const                              b;
+
+    CONSTRUCTOR(AdditionalVoidCastDerivedData, MEMBERS(b), BASES(AdditionalVoidCastBase));
+    ~AdditionalVoidCastDerivedData(void) override = default;
+
+    COMPARE(AdditionalVoidCastDerivedData, MEMBERS(b), BASES(AdditionalVoidCastBase));
+    SERIALIZATION(AdditionalVoidCastDerivedData, MEMBERS(b), BASES(AdditionalVoidCastBase), FLAGS(SERIALIZATION_DATA_ONLY));
+
+    virtual void Method(void) = 0;
+};
 
 struct AdditionalVoidCastDerived : public AdditionalVoidCastDerivedData {
     char const                              c;
@@ -586,3 +1253,511 @@ TEST_CASE("AdditionalVoidCast") {
         );
     }
 }
+
+TEST_CASE("SerializationSchema") {
+    SECTION("MultiMemberMultiBaseObj") {
+        using Schema                        = MultiMemberMultiBaseObj::SerializationSchema;
+
+        static_assert(std::is_same_v<Schema::Type, MultiMemberMultiBaseObj>);
+        static_assert(std::is_same_v<Schema::BaseTypes, std::tuple<SingleMemberObj, MultiMemberObj>>);
+        static_assert(Schema::NumFields == 3);
+        static_assert(Schema::IsCustom == false);
+
+        constexpr auto                      fields(Schema::GetFields());
+
+        static_assert(std::tuple_size_v<decltype(fields)> == Schema::NumFields);
+        static_assert(std::is_same_v<std::tuple_element_t<0, std::remove_const_t<decltype(fields)>>::Type, double>);
+        static_assert(std::is_same_v<std::tuple_element_t<1, std::remove_const_t<decltype(fields)>>::Type, float>);
+        static_assert(std::is_same_v<std::tuple_element_t<2, std::remove_const_t<decltype(fields)>>::Type, std::unique_ptr<MultiMemberObj>>);
+        static_assert(std::get<1>(fields).pointer == &MultiMemberMultiBaseObj::f);
+        static_assert(BoostHelpers::Serialization::GetSchemaFieldIndex<MultiMemberMultiBaseObj>("f") == 1);
+        static_assert(BoostHelpers::Serialization::GetSchemaFieldIndex<MultiMemberMultiBaseObj>("missing") == Schema::NumFields);
+
+        CHECK(std::string(Schema::TypeName) == "MultiMemberMultiBaseObj");
+
+        MultiMemberMultiBaseObj const       obj(10, true, 'c', 1.0, 2.0f, std::make_unique<MultiMemberObj>(true, 'q'));
+        std::vector<std::string>            names;
+
+        BoostHelpers::Serialization::ForEachSchemaField<MultiMemberMultiBaseObj>(
+            [&names](auto const &field) {
+                names.emplace_back(field.name);
+            }
+        );
+
+        CHECK(names == std::vector<std::string>{ "d", "f", "pMultiMember" });
+        CHECK(std::get<0>(fields).Get(obj) == 1.0);
+        CHECK(std::get<1>(fields).Get(obj) == 2.0f);
+        CHECK(&std::get<2>(fields).Get(obj) == &obj.pMultiMember);
+    }
+
+    SECTION("Base schemas") {
+        using Schema                        = std::tuple_element_t<1, MultiMemberMultiBaseObj::SerializationSchema::BaseTypes>::SerializationSchema;
+
+        static_assert(std::is_same_v<Schema::Type, MultiMemberObj>);
+        static_assert(Schema::NumFields == 2);
+
+        CHECK(std::string(std::get<1>(Schema::GetFields()).name) == "c");
+    }
+
+    SECTION("EmptyObj") {
+        static_assert(EmptyObj::SerializationSchema::NumFields == 0);
+        static_assert(std::tuple_size_v<decltype(EmptyObj::SerializationSchema::GetFields())> == 0);
+        static_assert(std::is_same_v<EmptyObj::SerializationSchema::BaseTypes, std::tuple<>>);
+    }
+
+    SECTION("CustomTypesObj") {
+        static_assert(CustomTypesObj::SerializationSchema::IsCustom);
+        static_assert(CustomTypesObj::SerializationSchema::NumFields == 0);
+    }
+}
+
+struct ReusableBaseObj {
+    std::string const                       name;
+
+    CONSTRUCTOR(ReusableBaseObj, name);
+    NON_COPYABLE(ReusableBaseObj);
+    MOVE(ReusableBaseObj, name);
+    COMPARE(ReusableBaseObj, name);
+    SERIALIZATION(ReusableBaseObj, MEMBERS(name), FLAGS(SERIALIZATION_DATA_ONLY));
+};
+
+struct ReusableObj : public ReusableBaseObj {
+    std::vector<int> const                  values;
+    std::unique_ptr<SingleMemberObj> const  pObj;
+
+    static size_t                           NumDeserializeFinalConstructCalls;
+
+    CONSTRUCTOR(ReusableObj, MEMBERS(values, pObj), BASES(ReusableBaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    NON_COPYABLE(ReusableObj);
+    MOVE(ReusableObj, MEMBERS(values, pObj), BASES(ReusableBaseObj));
+    COMPARE(ReusableObj, MEMBERS(values, pObj), BASES(ReusableBaseObj));
+    SERIALIZATION(ReusableObj, MEMBERS(values, pObj), BASES(ReusableBaseObj), FLAGS(SERIALIZATION_DESERIALIZE_INTO));
+
+private:
+    friend class CommonHelpers::TypeTraits::Access;
+
+    void DeserializeFinalConstruct(void) {
+        ++NumDeserializeFinalConstructCalls;
+
+        if(values.size() > 1000)
+            throw std::invalid_argument("values");
+    }
+};
+
+size_t ReusableObj::NumDeserializeFinalConstructCalls = 0;
+
+ReusableObj CreateReusableObj(int value, size_t numValues) {
+    return ReusableObj(
+        "The name of the object is " + std::to_string(value),
+        std::vector<int>(numValues, value),
+        value % 2 ? std::make_unique<SingleMemberObj>(value) : std::unique_ptr<SingleMemberObj>()
+    );
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void DeserializeIntoTest(void) {
+    std::vector<std::string>                messages;
+
+    for(int value = 0; value < 5; ++value) {
+        std::ostringstream                  out;
+
+        CreateReusableObj(value, 100 - static_cast<size_t>(value)).template Serialize<OArchiveT>(out);
+        messages.emplace_back(out.str());
+    }
+
+    ReusableObj                             obj(CreateReusableObj(100, 100));
+    int const * const                       pValues(obj.values.data());
+    char const * const                      pName(obj.name.data());
+
+    for(int value = 0; value < 5; ++value) {
+        std::istringstream                  in(messages[static_cast<size_t>(value)]);
+        size_t const                        numCalls(ReusableObj::NumDeserializeFinalConstructCalls);
+
+        ReusableObj::DeserializeInto<IArchiveT>(in, obj);
+
+        CHECK(CommonHelpers::Compare(obj, CreateReusableObj(value, 100 - static_cast<size_t>(value))) == 0);
+        CHECK(ReusableObj::NumDeserializeFinalConstructCalls == numCalls + 1);
+
+        // The storage of the members is reused
+        CHECK(obj.values.data() == pValues);
+        CHECK(obj.name.data() == pName);
+    }
+
+    // The content is the same as the content read by Deserialize
+    std::istringstream                      in(messages.back());
+
+    CHECK(CommonHelpers::Compare(ReusableObj::Deserialize<IArchiveT>(in), obj) == 0);
+}
+
+TEST_CASE("DeserializeInto") {
+    DeserializeIntoTest<boost::archive::text_oarchive, boost::archive::text_iarchive>();
+    DeserializeIntoTest<boost::archive::xml_oarchive, boost::archive::xml_iarchive>();
+    DeserializeIntoTest<boost::archive::binary_oarchive, boost::archive::binary_iarchive>();
+
+    SECTION("Archives") {
+        std::ostringstream                  out;
+
+        {
+            boost::archive::binary_oarchive ar(out);
+
+            CreateReusableObj(1, 10).Serialize(ar);
+            CreateReusableObj(2, 20).Serialize(ar);
+        }
+
+        std::istringstream                  in(out.str());
+        boost::archive::binary_iarchive     ar(in);
+        ReusableObj                         obj(CreateReusableObj(0, 0));
+
+        ReusableObj::DeserializeInto(ar, obj);
+        CHECK(CommonHelpers::Compare(obj, CreateReusableObj(1, 10)) == 0);
+
+        ReusableObj::DeserializeInto(ar, obj);
+        CHECK(CommonHelpers::Compare(obj, CreateReusableObj(2, 20)) == 0);
+    }
+
+    SECTION("Invariants") {
+        std::ostringstream                  out;
+
+        CreateReusableObj(1, 2000).Serialize<boost::archive::binary_oarchive>(out);
+
+        std::istringstream                  in(out.str());
+        ReusableObj                         obj(CreateReusableObj(0, 0));
+
+        CHECK_THROWS_AS(ReusableObj::DeserializeInto<boost::archive::binary_iarchive>(in, obj), std::invalid_argument);
+    }
+}
+
+struct DeltaPosition {
+    int const                               x;
+    int const                               y;
+
+    CONSTRUCTOR(DeltaPosition, x, y);
+    NON_COPYABLE(DeltaPosition);
+    MOVE(DeltaPosition, x, y);
+    COMPARE(DeltaPosition, x, y);
+    SERIALIZATION(DeltaPosition, x, y);
+};
+
+struct DeltaObj : public ReusableBaseObj {
+    int const                               tick;
+    DeltaPosition const                     position;
+    std::vector<int> const                  values;
+    std::unique_ptr<SingleMemberObj> const  pObj;
+
+    CONSTRUCTOR(DeltaObj, MEMBERS(tick, position, values, pObj), BASES(ReusableBaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    NON_COPYABLE(DeltaObj);
+    MOVE(DeltaObj, MEMBERS(tick, position, values, pObj), BASES(ReusableBaseObj));
+    COMPARE(DeltaObj, MEMBERS(tick, position, values, pObj), BASES(ReusableBaseObj));
+    SERIALIZATION(DeltaObj, MEMBERS(tick, position, values, pObj), BASES(ReusableBaseObj), FLAGS(SERIALIZATION_DELTA));
+};
+
+DeltaObj CreateDeltaObj(int tick, std::string name="Delta", int y=2, int pValue=3, size_t numValues=1000) {
+    return DeltaObj(
+        std::move(name),
+        tick,
+        DeltaPosition(1, y),
+        std::vector<int>(numValues, 5),
+        pValue ? std::make_unique<SingleMemberObj>(pValue) : std::unique_ptr<SingleMemberObj>()
+    );
+}
+
+template <typename OArchiveT, typename IArchiveT>
+size_t DeltaTest(DeltaObj const &updated) {
+    DeltaObj const                          baseline(CreateDeltaObj(1));
+    std::ostringstream                      out;
+
+    updated.template SerializeDelta<OArchiveT>(out, baseline);
+
+    std::istringstream                      in(out.str());
+    DeltaObj                                obj(CreateDeltaObj(1));
+    int const * const                       pValues(obj.values.data());
+
+    DeltaObj::ApplyDelta<IArchiveT>(in, obj);
+
+    CHECK(CommonHelpers::Compare(obj, updated) == 0);
+
+    // Unchanged members are moved into the updated object
+    if(updated.values == baseline.values)
+        CHECK(obj.values.data() == pValues);
+
+    return out.str().size();
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void DeltaTest(void) {
+    std::ostringstream                      out;
+
+    CreateDeltaObj(1).template Serialize<OArchiveT>(out);
+
+    size_t const                            fullSize(out.str().size());
+
+    CHECK(DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(1)) * 10 < fullSize);
+    CHECK(DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(2)) * 10 < fullSize);
+    CHECK(DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(1, "Other")) * 10 < fullSize);
+    CHECK(DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(1, "Delta", 20)) * 10 < fullSize);
+    CHECK(DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(1, "Delta", 2, 30)) * 10 < fullSize);
+    CHECK(DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(1, "Delta", 2, 0)) * 10 < fullSize);
+    DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(1, "Delta", 2, 3, 10));
+    DeltaTest<OArchiveT, IArchiveT>(CreateDeltaObj(2, "Other", 20, 0, 10));
+}
+
+TEST_CASE("Delta") {
+    DeltaTest<boost::archive::text_oarchive, boost::archive::text_iarchive>();
+    DeltaTest<boost::archive::xml_oarchive, boost::archive::xml_iarchive>();
+    DeltaTest<boost::archive::binary_oarchive, boost::archive::binary_iarchive>();
+
+    SECTION("Changed members") {
+        std::ostringstream                  out;
+
+        CreateDeltaObj(2, "Delta", 20).SerializeDelta<boost::archive::xml_oarchive>(out, CreateDeltaObj(1));
+
+        std::string const                   result(out.str());
+
+        CHECK(result.find("<tick>") != std::string::npos);
+        CHECK(result.find("<y>") != std::string::npos);
+        CHECK(result.find("<x>") == std::string::npos);
+        CHECK(result.find("<name>") == std::string::npos);
+        CHECK(result.find("<values>") == std::string::npos);
+        CHECK(result.find("<pObj>") == std::string::npos);
+    }
+
+    SECTION("Unchanged") {
+        std::ostringstream                  out;
+
+        {
+            boost::archive::binary_oarchive ar(out, boost::archive::no_header);
+
+            CreateDeltaObj(1).SerializeDelta(ar, CreateDeltaObj(1));
+        }
+
+        // One byte for the ReusableBaseObj bitmap and one byte for the DeltaObj bitmap
+        CHECK(out.str().size() == 2);
+    }
+
+    SECTION("Truncated") {
+        std::ostringstream                  out;
+
+        {
+            boost::archive::binary_oarchive ar(out, boost::archive::no_header);
+
+            CreateDeltaObj(2, "Other", 20, 0, 10).SerializeDelta(ar, CreateDeltaObj(1));
+        }
+
+        std::string const                   content(out.str());
+
+        for(size_t size = 0; size < content.size(); ++size) {
+            std::istringstream              in(content.substr(0, size));
+            boost::archive::binary_iarchive ar(in, boost::archive::no_header);
+            DeltaObj                        obj(CreateDeltaObj(1));
+            int const * const               pValues(obj.values.data());
+
+            CHECK_THROWS_AS(DeltaObj::ApplyDelta(ar, obj), boost::archive::archive_exception);
+
+            // The object is unchanged and none of its members were moved
+            CHECK(CommonHelpers::Compare(obj, CreateDeltaObj(1)) == 0);
+            CHECK(obj.values.data() == pValues);
+        }
+    }
+
+    SECTION("Archives") {
+        std::ostringstream                  out;
+
+        {
+            boost::archive::binary_oarchive ar(out);
+
+            CreateDeltaObj(2).SerializeDelta(ar, CreateDeltaObj(1));
+            CreateDeltaObj(3, "Other").SerializeDelta(ar, CreateDeltaObj(2));
+        }
+
+        std::istringstream                  in(out.str());
+        boost::archive::binary_iarchive     ar(in);
+        DeltaObj                            obj(CreateDeltaObj(1));
+
+        DeltaObj::ApplyDelta(ar, obj);
+        CHECK(CommonHelpers::Compare(obj, CreateDeltaObj(2)) == 0);
+
+        DeltaObj::ApplyDelta(ar, obj);
+        CHECK(CommonHelpers::Compare(obj, CreateDeltaObj(3, "Other")) == 0);
+    }
+}
+
+// ----------------------------------------------------------------------
+namespace NamesNamespace {
+
+struct NamesBaseObj {
+    int const a;
+
+    CONSTRUCTOR(NamesBaseObj, a);
+    NON_COPYABLE(NamesBaseObj);
+    MOVE(NamesBaseObj, a);
+    COMPARE(NamesBaseObj, a);
+    SERIALIZATION(NamesBaseObj, a);
+};
+
+} // namespace NamesNamespace
+
+struct NamesObj : public NamesNamespace::NamesBaseObj {
+    bool const b;
+
+    CONSTRUCTOR(NamesObj, MEMBERS(b), BASES(NamesNamespace::NamesBaseObj), FLAGS(CONSTRUCTOR_BASES_BEFORE_MEMBERS));
+    NON_COPYABLE(NamesObj);
+    MOVE(NamesObj, MEMBERS(b), BASES(NamesNamespace::NamesBaseObj));
+    COMPARE(NamesObj, MEMBERS(b), BASES(NamesNamespace::NamesBaseObj));
+    SERIALIZATION(NamesObj, MEMBERS(b), BASES(NamesNamespace::NamesBaseObj));
+};
+
+static_assert(std::string_view(BoostHelpers::Serialization::Details::ScrubSerializationName("NamesNamespace::NamesBaseObj")) == "NamesBaseObj");
+static_assert(std::string_view(BoostHelpers::Serialization::Details::ScrubSerializationName("Name")) == "Name");
+static_assert(std::string_view(BoostHelpers::Serialization::Details::ScrubSerializationName("Name<>")) == "GenericTag");
+
+static_assert(BoostHelpers::Serialization::Details::IgnoresSerializationNames<boost::archive::binary_oarchive>);
+static_assert(BoostHelpers::Serialization::Details::IgnoresSerializationNames<boost::archive::binary_iarchive>);
+static_assert(BoostHelpers::Serialization::Details::IgnoresSerializationNames<boost::archive::text_oarchive>);
+static_assert(BoostHelpers::Serialization::Details::IgnoresSerializationNames<boost::archive::text_iarchive>);
+static_assert(BoostHelpers::Serialization::Details::IgnoresSerializationNames<boost::archive::xml_oarchive> == false);
+static_assert(BoostHelpers::Serialization::Details::IgnoresSerializationNames<boost::archive::xml_iarchive> == false);
+
+TEST_CASE("Names") {
+    NamesObj const                          obj(10, true);
+
+    TestImpl(obj);
+    TestImplArchive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>(obj);
+
+    // Bases are written with the scrubbed name
+    {
+        std::ostringstream                  out;
+
+        obj.Serialize<boost::archive::xml_oarchive>(out);
+
+        std::string const                   result(out.str());
+
+        CHECK(result.find("<NamesBaseObj") != std::string::npos);
+        CHECK(result.find("<b>") != std::string::npos);
+    }
+
+    // The output is the same with or without the nvp wrapper when names are ignored
+    {
+        std::ostringstream                  withoutNvp;
+        std::ostringstream                  withNvp;
+
+        obj.Serialize<boost::archive::text_oarchive>(withoutNvp);
+
+        {
+            boost::archive::text_oarchive   ar(withNvp);
+            NamesObj::SerializationPOD::SerializeData const     data(obj);
+
+            ar << boost::serialization::make_nvp("NamesObj", data);
+        }
+
+        CHECK(withoutNvp.str() == withNvp.str());
+    }
+}
+
+// ----------------------------------------------------------------------
+namespace FingerprintV1 {
+
+struct FingerprintObj {
+    int const a;
+    std::string const b;
+    std::unique_ptr<SingleMemberObj> const c;
+
+    CONSTRUCTOR(FingerprintObj, MEMBERS(a, b, c));
+    NON_COPYABLE(FingerprintObj);
+    MOVE(FingerprintObj, MEMBERS(a, b, c));
+    COMPARE(FingerprintObj, MEMBERS(a, b, c));
+    SERIALIZATION(FingerprintObj, MEMBERS(a, b, c));
+};
+
+} // namespace FingerprintV1
+
+namespace FingerprintV2 {
+
+// Same as FingerprintV1
+struct FingerprintObj {
+    int const a;
+    std::string const b;
+    std::unique_ptr<SingleMemberObj> const c;
+
+    CONSTRUCTOR(FingerprintObj, MEMBERS(a, b, c));
+    NON_COPYABLE(FingerprintObj);
+    MOVE(FingerprintObj, MEMBERS(a, b, c));
+    COMPARE(FingerprintObj, MEMBERS(a, b, c));
+    SERIALIZATION(FingerprintObj, MEMBERS(a, b, c));
+};
+
+} // namespace FingerprintV2
+
+namespace FingerprintMemberType {
+
+struct FingerprintObj {
+    double const a;
+    std::string const b;
+    std::unique_ptr<SingleMemberObj> const c;
+
+    CONSTRUCTOR(FingerprintObj, MEMBERS(a, b, c));
+    NON_COPYABLE(FingerprintObj);
+    MOVE(FingerprintObj, MEMBERS(a, b, c));
+    COMPARE(FingerprintObj, MEMBERS(a, b, c));
+    SERIALIZATION(FingerprintObj, MEMBERS(a, b, c));
+};
+
+} // namespace FingerprintMemberType
+
+namespace FingerprintMemberName {
+
+struct FingerprintObj {
+    int const x;
+    std::string const b;
+    std::unique_ptr<SingleMemberObj> const c;
+
+    CONSTRUCTOR(FingerprintObj, MEMBERS(x, b, c));
+    NON_COPYABLE(FingerprintObj);
+    MOVE(FingerprintObj, MEMBERS(x, b, c));
+    COMPARE(FingerprintObj, MEMBERS(x, b, c));
+    SERIALIZATION(FingerprintObj, MEMBERS(x, b, c));
+};
+
+} // namespace FingerprintMemberName
+
+namespace FingerprintVersion {
+
+struct FingerprintObj {
+    int const a;
+    std::string const b;
+    std::unique_ptr<SingleMemberObj> const c;
+
+    CONSTRUCTOR(FingerprintObj, MEMBERS(a, b, c));
+    NON_COPYABLE(FingerprintObj);
+    MOVE(FingerprintObj, MEMBERS(a, b, c));
+    COMPARE(FingerprintObj, MEMBERS(a, b, c));
+    SERIALIZATION(FingerprintObj, MEMBERS(a, b, c), FLAGS(SERIALIZATION_VERSION(2)));
+};
+
+} // namespace FingerprintVersion
+
+TEST_CASE("SchemaFingerprint") {
+    using namespace BoostHelpers::Serialization;
+
+    constexpr std::uint64_t const           fingerprint(GetSchemaFingerprint<FingerprintV1::FingerprintObj>());
+
+    // Types with the same name and structure have the same fingerprint, regardless of namespace
+    static_assert(fingerprint == GetSchemaFingerprint<FingerprintV2::FingerprintObj>());
+
+    static_assert(fingerprint != GetSchemaFingerprint<FingerprintMemberType::FingerprintObj>());
+    static_assert(fingerprint != GetSchemaFingerprint<FingerprintMemberName::FingerprintObj>());
+    static_assert(fingerprint != GetSchemaFingerprint<FingerprintVersion::FingerprintObj>());
+
+    // Bases and nested objects are included
+    static_assert(GetSchemaFingerprint<SingleBaseObj>() != GetSchemaFingerprint<SingleMemberObj>());
+    static_assert(GetSchemaFingerprint<MultiMemberMultiBaseObj>() != GetSchemaFingerprint<MultiMemberObj>());
+
+    // Enums are described by their underlying type
+    static_assert(Details::AddSchemaTypeFingerprint<SmallEnum>(Details::SchemaFingerprintBasis) != Details::AddSchemaTypeFingerprint<FixedSizeObj::Value>(Details::SchemaFingerprintBasis));
+
+    // Flags that change the format are included
+    static_assert(BaseObj::SerializationSchema::FormatFlags == (static_cast<unsigned int>(SchemaFormatFlag::Abstract) | static_cast<unsigned int>(SchemaFormatFlag::Polymorphic)));
+    static_assert(BitwiseObj::SerializationSchema::FormatFlags == static_cast<unsigned int>(SchemaFormatFlag::Bitwise));
+    static_assert(SingleMemberObj::SerializationSchema::FormatFlags == 0);
+
+    CHECK(fingerprint != 0);
+}
@@ -0,0 +1,223 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SerializeColumns_UnitTest.cpp
+///  \brief         Unit test for SerializeColumns.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 21:40:05
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../SerializeColumns.h"
+#include <catch.hpp>
+
+#include <CommonHelpers/Compare.h>
+#include <CommonHelpers/Copy.h>
+#include <CommonHelpers/Constructor.h>
+#include <CommonHelpers/Move.h>
+
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/unique_ptr.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "../TestHelpers.h"
+
+struct Leg {
+    int const                               quantity;
+
+    CONSTRUCTOR(Leg, quantity);
+    NON_COPYABLE(Leg);
+    MOVE(Leg, quantity);
+    COMPARE(Leg, quantity);
+    SERIALIZATION(Leg, quantity);
+};
+
+struct Trade {
+    int const                               id;
+    double const                            price;
+    std::string const                       symbol;
+    Leg const                               leg;
+    std::unique_ptr<Leg> const              pLeg;
+
+    CONSTRUCTOR(Trade, id, price, symbol, leg, pLeg);
+    NON_COPYABLE(Trade);
+    MOVE(Trade, id, price, symbol, leg, pLeg);
+    COMPARE(Trade, id, price, symbol, leg, pLeg);
+    SERIALIZATION(Trade, id, price, symbol, leg, pLeg);
+};
+
+struct Quote {
+    int const                               id;
+    double const                            price;
+
+    CONSTRUCTOR(Quote, id, price);
+    NON_COPYABLE(Quote);
+    MOVE(Quote, id, price);
+    COMPARE(Quote, id, price);
+    SERIALIZATION(Quote, id, price);
+};
+
+std::vector<Trade> CreateTrades(size_t num_trades) {
+    std::vector<Trade>                      result;
+
+    for(size_t index = 0; index < num_trades; ++index) {
+        int const                           value(static_cast<int>(index));
+
+        result.emplace_back(
+            value,
+            value * 1.5,
+            "Symbol" + std::to_string(value),
+            Leg(value * 10),
+            index % 2 ? std::make_unique<Leg>(value * 100) : std::unique_ptr<Leg>()
+        );
+    }
+
+    return result;
+}
+
+TEST_CASE("Objects") {
+    // SerializeTest includes a round trip through SerializeColumns
+    for(Trade const &trade : CreateTrades(2))
+        CHECK(BoostHelpers::TestHelpers::SerializeTest(trade) == 0);
+
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(Quote(1, 2.0)) == 0);
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void TestImpl(size_t num_trades) {
+    std::vector<Trade> const                trades(CreateTrades(num_trades));
+
+    // Objects referenced by pointers are tracked by the archive, so the second
+    // set of columns is written from different objects.
+    std::vector<Trade> const                otherTrades(CreateTrades(num_trades));
+
+    std::ostringstream                      out;
+
+    {
+        OArchiveT                           ar(out);
+
+        BoostHelpers::Serialization::SerializeColumns(ar, trades.begin(), trades.end());
+        BoostHelpers::Serialization::SerializeColumns(ar, otherTrades.begin(), otherTrades.end());
+    }
+
+    std::string const                       result(out.str());
+
+    UNSCOPED_INFO(result);
+
+    std::istringstream                      in(result);
+    IArchiveT                               ar(in);
+
+    // All columns
+    std::vector<Trade>                      other;
+
+    BoostHelpers::Serialization::DeserializeColumns(ar, other);
+
+    CHECK(other.capacity() == num_trades);
+    CHECK(CommonHelpers::Compare(other, trades) == 0);
+
+    // Subset of columns
+    auto [symbols, prices] = BoostHelpers::Serialization::DeserializeColumns<
+        Trade,
+        BoostHelpers::Serialization::GetSchemaFieldIndex<Trade>("symbol"),
+        BoostHelpers::Serialization::GetSchemaFieldIndex<Trade>("price")
+    >(ar);
+
+    static_assert(std::is_same_v<decltype(symbols), std::vector<std::string>>);
+    static_assert(std::is_same_v<decltype(prices), std::vector<double>>);
+
+    REQUIRE(symbols.size() == num_trades);
+    REQUIRE(prices.size() == num_trades);
+
+    for(size_t index = 0; index < num_trades; ++index) {
+        CHECK(symbols[index] == trades[index].symbol);
+        CHECK(prices[index] == trades[index].price);
+    }
+}
+
+TEST_CASE("Archives") {
+    using namespace BoostHelpers::TestHelpers;
+
+    ForEachTestArchive<TestArchive::Text, TestArchive::Xml, TestArchive::Binary>(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>(0);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>(1);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>(10);
+        }
+    );
+}
+
+TEST_CASE("Binary layout") {
+    std::vector<Quote>                      quotes;
+
+    for(int index = 0; index < 100; ++index)
+        quotes.emplace_back(index, index * 2.0);
+
+    std::ostringstream                      countOut;
+
+    {
+        boost::archive::binary_oarchive                     ar(countOut);
+        boost::serialization::collection_size_type const    count(quotes.size());
+
+        ar << boost::serialization::make_nvp("count", count);
+    }
+
+    std::ostringstream                      out;
+
+    BoostHelpers::Serialization::SerializeColumns<boost::archive::binary_oarchive>(out, quotes.begin(), quotes.end());
+
+    std::string const                       result(out.str());
+    size_t const                            columnsOffset(countOut.str().size());
+
+    // Each column is written as a contiguous array of raw values
+    REQUIRE(result.size() == columnsOffset + quotes.size() * (sizeof(int) + sizeof(double)));
+
+    int                                     ids[100];
+    double                                  prices[100];
+
+    std::memcpy(ids, result.data() + columnsOffset, sizeof(ids));
+    std::memcpy(prices, result.data() + columnsOffset + sizeof(ids), sizeof(prices));
+
+    for(int index = 0; index < 100; ++index) {
+        CHECK(ids[index] == index);
+        CHECK(prices[index] == index * 2.0);
+    }
+
+    std::istringstream                      in(result);
+    std::vector<Quote>                      other;
+
+    BoostHelpers::Serialization::DeserializeColumns<boost::archive::binary_iarchive>(in, other);
+    CHECK(CommonHelpers::Compare(other, quotes) == 0);
+
+    // Skipped columns are still consumed from the archive
+    std::istringstream                      pricesIn(result);
+    boost::archive::binary_iarchive         pricesAr(pricesIn);
+
+    auto [otherPrices] = BoostHelpers::Serialization::DeserializeColumns<Quote, 1>(pricesAr);
+
+    CHECK(otherPrices == std::vector<double>(prices, prices + 100));
+    CHECK(pricesIn.peek() == std::char_traits<char>::eof());
+}
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SerializeRange_UnitTest.cpp
+///  \brief         Unit test for SerializeRange.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-14 19:31:48
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../SerializeRange.h"
+#include <catch.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "SequenceTestObjs.h"
+#include "../TestHelpers.h"
+
+#include <list>
+
+template <typename OArchiveT, typename IArchiveT>
+void TestImpl(size_t num_objs) {
+    std::vector<Obj> const                  objs(CreateObjs(num_objs));
+
+    // Objects referenced by pointers are tracked by the archive, so the second
+    // range is written from different objects.
+    std::vector<Obj> const                  otherObjs(CreateObjs(num_objs));
+
+    std::ostringstream                      out;
+
+    {
+        OArchiveT                           ar(out);
+
+        BoostHelpers::Serialization::SerializeRange(ar, objs.begin(), objs.end());
+        BoostHelpers::Serialization::SerializeRange(ar, otherObjs.rbegin(), otherObjs.rend());
+    }
+
+    std::string const                       result(out.str());
+
+    UNSCOPED_INFO(result);
+
+    std::istringstream                      in(result);
+    IArchiveT                               ar(in);
+
+    // Vector
+    std::vector<Obj>                        vectorObjs;
+
+    BoostHelpers::Serialization::DeserializeRange<IArchiveT, Obj>(ar, vectorObjs);
+
+    CHECK(vectorObjs.capacity() == num_objs);
+    CHECK(CommonHelpers::Compare(vectorObjs, objs) == 0);
+
+    // Output iterator
+    std::list<Obj>                          listObjs;
+
+    BoostHelpers::Serialization::DeserializeRange<IArchiveT, Obj>(ar, std::front_inserter(listObjs));
+
+    CHECK(CommonHelpers::Compare(std::vector<Obj>(std::make_move_iterator(listObjs.begin()), std::make_move_iterator(listObjs.end())), objs) == 0);
+}
+
+TEST_CASE("Objects") {
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(Obj::Create(0)) == 0);
+    CHECK(BoostHelpers::TestHelpers::SerializeTest(Obj::Create(1)) == 0);
+}
+
+TEST_CASE("Archives") {
+    using namespace BoostHelpers::TestHelpers;
+
+    ForEachTestArchive<TestArchive::Text, TestArchive::Xml, TestArchive::Binary>(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>(0);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>(1);
+            TestImpl<typename Traits::OArchive, typename Traits::IArchive>(10);
+        }
+    );
+}
+
+TEST_CASE("Streams") {
+    std::vector<Obj> const                  objs(CreateObjs(5));
+    std::ostringstream                      out;
+
+    BoostHelpers::Serialization::SerializeRange<boost::archive::text_oarchive>(out, objs.begin(), objs.end());
+
+    std::istringstream                      in(out.str());
+    std::vector<Obj>                        other(CreateObjs(2));
+
+    BoostHelpers::Serialization::DeserializeRange<boost::archive::text_iarchive, Obj>(in, other);
+
+    // Deserialized elements are appended to the existing ones
+    REQUIRE(other.size() == 7);
+    CHECK(CommonHelpers::Compare(other[0], objs[0]) == 0);
+    CHECK(CommonHelpers::Compare(other[1], objs[1]) == 0);
+
+    other.erase(other.begin(), other.begin() + 2);
+    CHECK(CommonHelpers::Compare(other, objs) == 0);
+}
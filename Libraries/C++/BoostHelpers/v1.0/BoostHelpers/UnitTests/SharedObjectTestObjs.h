@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          SharedObjectTestObjs.h
+///  \brief         Objects used by the SharedObject.h unit tests and
+///                 benchmarks
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-15 16:52:05
+///
+///  \note          This file defines the polymorphic types; include it in
+///                 a single translation unit per binary.
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <BoostHelpers/Serialization.suffix.h>
+
+#include <memory>
+#include <vector>
+
+struct Base : public BoostHelpers::SharedObject {
+    int const                               I;
+
+    CREATE(Base);
+
+    template <typename PrivateConstructorTagT>
+    Base(PrivateConstructorTagT tag, int i) :
+        BoostHelpers::SharedObject(tag),
+        I(i)
+    {}
+
+#define ARGS                                MEMBERS(I), BASES(BoostHelpers::SharedObject)
+
+    NON_COPYABLE(Base);
+    MOVE(Base, ARGS);
+    COMPARE(Base, ARGS);
+    SERIALIZATION(Base, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC_BASE, SERIALIZATION_SHARED_OBJECT));
+
+#undef ARGS
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Base);
+
+struct Derived : public Base {
+    bool const                              B;
+
+    CREATE(Derived);
+
+    template <typename PrivateConstructorTagT>
+    Derived(PrivateConstructorTagT tag, int i, bool b) :
+        Base(tag, i),
+        B(b)
+    {}
+
+#define ARGS                                MEMBERS(B), BASES(Base)
+
+    NON_COPYABLE(Derived);
+    MOVE(Derived, ARGS);
+    COMPARE(Derived, ARGS);
+    SERIALIZATION(Derived, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Base), SERIALIZATION_SHARED_OBJECT));
+
+#undef ARGS
+};
+
+SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Derived);
+
+// A graph where nodes may be referenced more than once
+struct Graph : public BoostHelpers::SharedObject {
+    std::vector<std::shared_ptr<Base>> const                                Nodes;
+
+    CREATE(Graph);
+
+    template <typename PrivateConstructorTagT>
+    Graph(PrivateConstructorTagT tag, std::vector<std::shared_ptr<Base>> nodes) :
+        BoostHelpers::SharedObject(tag),
+        Nodes(std::move(nodes))
+    {}
+
+#define ARGS                                MEMBERS(Nodes), BASES(BoostHelpers::SharedObject)
+
+    NON_COPYABLE(Graph);
+    MOVE(Graph, ARGS);
+    SERIALIZATION(Graph, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT));
+
+#undef ARGS
+};
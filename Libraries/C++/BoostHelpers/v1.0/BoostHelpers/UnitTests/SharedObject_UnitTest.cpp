@@ -27,53 +27,9 @@
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 
-#include <BoostHelpers/Serialization.suffix.h>
+#include "SharedObjectTestObjs.h"
 
-struct Base : public BoostHelpers::SharedObject {
-    int const                               I;
-
-    CREATE(Base);
-
-    template <typename PrivateConstructorTagT>
-    Base(PrivateConstructorTagT tag, int i) :
-        BoostHelpers::SharedObject(tag),
-        I(i)
-    {}
-
-#define ARGS                                MEMBERS(I), BASES(BoostHelpers::SharedObject)
-
-    NON_COPYABLE(Base);
-    MOVE(Base, ARGS);
-    COMPARE(Base, ARGS);
-    SERIALIZATION(Base, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC_BASE, SERIALIZATION_SHARED_OBJECT));
-
-#undef ARGS
-};
-
-SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Base);
-
-struct Derived : public Base {
-    bool const                              B;
-
-    CREATE(Derived);
-
-    template <typename PrivateConstructorTagT>
-    Derived(PrivateConstructorTagT tag, int i, bool b) :
-        Base(tag, i),
-        B(b)
-    {}
-
-#define ARGS                                MEMBERS(B), BASES(Base)
-
-    NON_COPYABLE(Derived);
-    MOVE(Derived, ARGS);
-    COMPARE(Derived, ARGS);
-    SERIALIZATION(Derived, ARGS, FLAGS(SERIALIZATION_POLYMORPHIC(Base), SERIALIZATION_SHARED_OBJECT));
-
-#undef ARGS
-};
-
-SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Derived);
+#include <thread>
 
 TEST_CASE("Standard") {
 #if 0
@@ -180,6 +136,127 @@ TEST_CASE("Serialization via boost") {
     CHECK(pDerived1.get() == pDerived2.get());
 }
 
+TEST_CASE("Graph Serialization") {
+    std::vector<std::shared_ptr<Base>>      nodes;
+
+    nodes.emplace_back(Base::Create(10));
+    nodes.emplace_back(Derived::Create(20, true));
+    nodes.emplace_back(nodes[0]);
+    nodes.emplace_back(nodes[1]);
+
+    std::shared_ptr<Graph>                  original(Graph::Create(std::move(nodes)));
+    std::ostringstream                      out;
+    boost::archive::text_oarchive           aout(out);
+
+    original->SerializePtr(aout);
+    out.flush();
+
+    std::string                             result(out.str());
+
+    UNSCOPED_INFO(result);
+
+    std::istringstream                      in(result);
+    boost::archive::text_iarchive           ain(in);
+    std::shared_ptr<Graph> const            other(Graph::DeserializePtr(ain));
+
+    REQUIRE(other->Nodes.size() == 4);
+    CHECK(*other->Nodes[0] == *original->Nodes[0]);
+    CHECK(static_cast<Derived const &>(*other->Nodes[1]) == static_cast<Derived const &>(*original->Nodes[1]));
+    CHECK(other->Nodes[2].get() == other->Nodes[0].get());
+    CHECK(other->Nodes[3].get() == other->Nodes[1].get());
+}
+
+struct PooledNode : public BoostHelpers::SharedObject {
+    int const                               I;
+
+    CREATE(PooledNode);
+    SHARED_OBJECT_POOLED();
+
+    template <typename PrivateConstructorTagT>
+    PooledNode(PrivateConstructorTagT tag, int i) :
+        BoostHelpers::SharedObject(tag),
+        I(i)
+    {}
+
+#define ARGS                                MEMBERS(I), BASES(BoostHelpers::SharedObject)
+
+    NON_COPYABLE(PooledNode);
+    MOVE(PooledNode, ARGS);
+    COMPARE(PooledNode, ARGS);
+    SERIALIZATION(PooledNode, ARGS, FLAGS(SERIALIZATION_SHARED_OBJECT));
+
+#undef ARGS
+};
+
+TEST_CASE("Pooled allocation") {
+    std::shared_ptr<PooledNode>             pNode(PooledNode::Create(10));
+    void const * const                      pAddress(pNode.get());
+
+    CHECK(pNode->CreateSharedPtr<PooledNode>().get() == pAddress);
+
+    // Freed memory is reused by the next object
+    pNode.reset();
+    pNode = PooledNode::Create(20);
+
+    CHECK(pNode.get() == pAddress);
+    CHECK(pNode->I == 20);
+
+    // Objects may be freed on a different thread
+    std::shared_ptr<PooledNode>             pOther;
+
+    std::thread([&pOther](void) { pOther = PooledNode::Create(30); }).join();
+
+    CHECK(pOther->I == 30);
+    pOther.reset();
+
+    // Deserialized objects are allocated from the pool
+    std::ostringstream                      out;
+
+    {
+        boost::archive::text_oarchive       aout(out);
+
+        pNode->SerializePtr(aout);
+    }
+
+    std::string const                       result(out.str());
+    void const *                            pDeserializedAddress(nullptr);
+
+    {
+        std::istringstream                  in(result);
+        boost::archive::text_iarchive       ain(in);
+        std::shared_ptr<PooledNode> const   pDeserialized(PooledNode::DeserializePtr(ain));
+
+        CHECK(*pDeserialized == *pNode);
+        pDeserializedAddress = pDeserialized.get();
+    }
+
+    std::istringstream                      in(result);
+    boost::archive::text_iarchive           ain(in);
+    std::shared_ptr<PooledNode> const       pDeserialized(PooledNode::DeserializePtr(ain));
+
+    CHECK(*pDeserialized == *pNode);
+    CHECK(pDeserialized.get() == pDeserializedAddress);
+}
+
+TEST_CASE("SharedObjectPoolAllocator") {
+    using Allocator                         = BoostHelpers::SharedObjectPoolAllocator<int>;
+
+    Allocator                               allocator;
+    int * const                             pValues(allocator.allocate(10));
+
+    allocator.deallocate(pValues, 10);
+    CHECK(allocator.allocate(10) == pValues);
+    allocator.deallocate(pValues, 10);
+
+    // Blocks that are too large aren't cached
+    size_t const                            numLarge(BoostHelpers::Details::SharedObjectPool::MaxBlockSize / sizeof(int) + 1);
+    int * const                             pLarge(allocator.allocate(numLarge));
+
+    allocator.deallocate(pLarge, numLarge);
+
+    CHECK(BoostHelpers::SharedObjectPoolAllocator<char>(allocator) == allocator);
+}
+
 // Ideally, this code would result in a compile-time error as it is attempting to serialize and
 // deserialize the objects themselves rather than via smart pointers. However, there doesn't seem
 // to be a way to do this.
@@ -0,0 +1,187 @@
+/////////////////////////////////////////////////////////////////////////
+///
+///  \file          StreamReader_UnitTest.cpp
+///  \brief         Unit test for StreamReader.h
+///
+///  \author        David Brownell <db@DavidBrownell.com>
+///  \date          2026-10-15 09:40:12
+///
+///  \note
+///
+///  \bug
+///
+/////////////////////////////////////////////////////////////////////////
+///
+///  \attention
+///  Copyright David Brownell 2026
+///  Distributed under the Boost Software License, Version 1.0. See
+///  accompanying file LICENSE_1_0.txt or copy at
+///  http://www.boost.org/LICENSE_1_0.txt.
+///
+/////////////////////////////////////////////////////////////////////////
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_CONSOLE_WIDTH 200
+#include "../StreamReader.h"
+#include <catch.hpp>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+
+#include <boost/archive/xml_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+
+#include "SequenceTestObjs.h"
+#include "../TestHelpers.h"
+
+template <typename IArchiveT, typename T>
+std::vector<T> ReadAll(std::string const &data, BoostHelpers::Serialization::StreamFormat format, size_t expected_size) {
+    std::istringstream                      in(data);
+    std::vector<T>                          results;
+    BoostHelpers::Serialization::StreamReader<IArchiveT, T> const           reader(in, format);
+
+    CHECK(reader.GetRemaining() + (expected_size ? 1 : 0) == expected_size);
+
+    for(T &value : reader)
+        results.emplace_back(std::move(value));
+
+    return results;
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void RangeTest(void) {
+    for(size_t num_objs : { 0, 1, 20 }) {
+        std::vector<Obj> const              objs(CreateObjs(num_objs));
+        std::ostringstream                  out;
+
+        BoostHelpers::Serialization::SerializeRange<OArchiveT>(out, objs.begin(), objs.end());
+
+        CHECK(CommonHelpers::Compare(ReadAll<IArchiveT, Obj>(out.str(), BoostHelpers::Serialization::StreamFormat::Range, num_objs), objs) == 0);
+    }
+}
+
+template <typename OArchiveT, typename IArchiveT>
+void VectorTest(void) {
+    for(size_t num_objs : { 0, 1, 20 }) {
+        std::vector<Obj> const              objs(CreateObjs(num_objs));
+        std::vector<int> const              values(num_objs, 42);
+
+        {
+            std::ostringstream              out;
+
+            {
+                OArchiveT                   ar(out);
+
+                ar << boost::serialization::make_nvp("items", objs);
+            }
+
+            CHECK(CommonHelpers::Compare(ReadAll<IArchiveT, Obj>(out.str(), BoostHelpers::Serialization::StreamFormat::Vector, num_objs), objs) == 0);
+        }
+
+        {
+            std::ostringstream              out;
+
+            {
+                OArchiveT                   ar(out);
+
+                ar << boost::serialization::make_nvp("items", values);
+            }
+
+            CHECK(ReadAll<IArchiveT, int>(out.str(), BoostHelpers::Serialization::StreamFormat::Vector, num_objs) == values);
+        }
+    }
+}
+
+TEST_CASE("IsStreamArrayOptimized") {
+    // Vectors of ints are written as a single array by binary archives
+    CHECK(BoostHelpers::Serialization::Details::IsStreamArrayOptimized<boost::archive::binary_iarchive, int>);
+    CHECK(BoostHelpers::Serialization::Details::IsStreamArrayOptimized<boost::archive::binary_iarchive, Obj> == false);
+}
+
+TEST_CASE("Range") {
+    using namespace BoostHelpers::TestHelpers;
+
+    ForEachTestArchive<TestArchive::Text, TestArchive::Xml, TestArchive::Binary>(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            RangeTest<typename Traits::OArchive, typename Traits::IArchive>();
+        }
+    );
+}
+
+TEST_CASE("Vector") {
+    using namespace BoostHelpers::TestHelpers;
+
+    ForEachTestArchive<TestArchive::Text, TestArchive::Binary>(
+        [](auto traits) {
+            using Traits                    = decltype(traits);
+
+            INFO(Traits::Name);
+            VectorTest<typename Traits::OArchive, typename Traits::IArchive>();
+        }
+    );
+}
+
+TEST_CASE("Shared archive") {
+    std::vector<Obj> const                  objs(CreateObjs(5));
+    std::ostringstream                      out;
+
+    {
+        boost::archive::binary_oarchive     ar(out);
+
+        BoostHelpers::Serialization::SerializeRange(ar, objs.begin(), objs.end());
+        BoostHelpers::Serialization::SerializeRange(ar, objs.begin() + 2, objs.end());
+        ar << std::string("Done");
+    }
+
+    std::istringstream                      in(out.str());
+    boost::archive::binary_iarchive         ar(in);
+    size_t                                  index(0);
+
+    for(Obj const &obj : BoostHelpers::Serialization::StreamReader<boost::archive::binary_iarchive, Obj>(ar))
+        CHECK(CommonHelpers::Compare(obj, objs[index++]) == 0);
+
+    CHECK(index == 5);
+
+    BoostHelpers::Serialization::StreamReader<boost::archive::binary_iarchive, Obj>                 reader(ar);
+    BoostHelpers::Serialization::StreamReader<boost::archive::binary_iarchive, Obj> const           copy(reader);
+
+    CHECK(reader == copy);
+    CHECK(reader != BoostHelpers::Serialization::StreamReader<boost::archive::binary_iarchive, Obj>());
+
+    for(index = 2; reader != end(reader); ++reader)
+        CHECK(CommonHelpers::Compare(*reader, objs[index++]) == 0);
+
+    CHECK(index == 5);
+    CHECK(copy == reader);
+
+    std::string                             done;
+
+    ar >> done;
+    CHECK(done == "Done");
+}
+
+TEST_CASE("Errors") {
+    std::ostringstream                      out;
+
+    {
+        boost::archive::binary_oarchive     ar(out);
+    }
+
+    std::istringstream                      in(out.str());
+
+    CHECK_THROWS_MATCHES(
+        (BoostHelpers::Serialization::StreamReader<boost::archive::binary_iarchive, int>(in, BoostHelpers::Serialization::StreamFormat::Range)),
+        std::invalid_argument,
+        Catch::Matchers::Message("StreamFormat::Range is only available for types generated by SERIALIZATION")
+    );
+
+    BoostHelpers::Serialization::StreamReader<boost::archive::binary_iarchive, Obj> const           reader;
+
+    CHECK(reader.GetRemaining() == 0);
+    CHECK_THROWS_AS(*reader, std::logic_error);
+}
@@ -21,6 +21,7 @@
 /////////////////////////////////////////////////////////////////////////
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
 #define CATCH_CONFIG_CONSOLE_WIDTH 200
+#define TEST_HELPERS_COUNT_ALLOCATIONS
 #include "../TestHelpers.h"
 #include <catch.hpp>
 
@@ -28,6 +29,8 @@
 #include <CommonHelpers/Copy.h>
 #include <CommonHelpers/Move.h>
 
+#include <vector>
+
 struct Base {
     int const                               I;
     bool const                              B;
@@ -75,5 +78,115 @@ TEST_CASE("WithFunc") {
     CHECK(BoostHelpers::TestHelpers::SerializePtrTest<std::shared_ptr<Base>, Derived>(std::make_shared<Derived>(10, true, 3.0), onSerializedFunc) == 0);
 }
 
+TEST_CASE("Results") {
+    using namespace BoostHelpers::TestHelpers;
+
+    std::vector<SerializeTestResult>        results;
+    SerializeTestOptions                    options;
+
+    options.onResultFunc = [&results](SerializeTestResult const &result) { results.emplace_back(result); };
+
+    SECTION("Object") {
+        CHECK(SerializeTest(Base(10, true), options) == 0);
+
+        REQUIRE(results.size() == 5);
+        CHECK(results[0].archive == TestArchive::Text);
+        CHECK(results[1].archive == TestArchive::Xml);
+        CHECK(results[2].archive == TestArchive::Compact);
+        CHECK(results[3].archive == TestArchive::Binary);
+        CHECK(results[4].archive == TestArchive::Columns);
+
+        // Compact archives don't write names or the full archive header
+        CHECK(results[2].numBytes < results[3].numBytes);
+        CHECK(results[3].numBytes < results[1].numBytes);
+
+        for(SerializeTestResult const &result : results) {
+            CHECK(result.numBytes > 0);
+            REQUIRE(result.numAllocations.has_value());
+            CHECK(*result.numAllocations > 0);
+        }
+    }
+
+    SECTION("Object with bases") {
+        // Columns aren't available for types with bases
+        CHECK(SerializeTest(Derived(10, true, 3.0), options) == 0);
+        CHECK(results.size() == 4);
+    }
+
+    SECTION("Pointer") {
+        CHECK(SerializePtrTest<std::shared_ptr<Base>, Derived>(std::make_shared<Derived>(10, true, 3.0), options) == 0);
+
+        REQUIRE(results.size() == 4);
+        CHECK(results[3].archive == TestArchive::Binary);
+    }
+}
+
+TEST_CASE("Limits") {
+    using namespace BoostHelpers::TestHelpers;
+
+    std::vector<SerializeTestResult>        results;
+    SerializeTestOptions                    options;
+
+    options.onResultFunc = [&results](SerializeTestResult const &result) { results.emplace_back(result); };
+
+    CHECK(SerializeTest(Base(10, true), options) == 0);
+    REQUIRE(results.size() == 5);
+
+    SECTION("Within limits") {
+        options.limits[TestArchive::Binary] = SerializeTestLimits{ results[3].numBytes, *results[3].numAllocations };
+
+        CHECK(SerializeTest(Base(10, true), options) == 0);
+    }
+
+    SECTION("Bytes") {
+        options.limits[TestArchive::Binary].maxBytes = results[3].numBytes - 1;
+
+        CHECK(SerializeTest(Base(10, true), options) == static_cast<unsigned char>(TestArchive::Binary));
+        CHECK(SerializePtrTest(std::make_shared<Derived>(10, true, 3.0), options) == static_cast<unsigned char>(TestArchive::Binary));
+    }
+
+    SECTION("Allocations") {
+        options.limits[TestArchive::Compact].maxAllocations = 0;
+
+        CHECK(SerializeTest(Base(10, true), options) == static_cast<unsigned char>(TestArchive::Compact));
+    }
+
+    SECTION("Columns") {
+        options.limits[TestArchive::Columns].maxBytes = 1;
+
+        CHECK(SerializeTest(Base(10, true), options) == static_cast<unsigned char>(TestArchive::Columns));
+        CHECK(SerializeTest(Derived(10, true, 3.0), options) == 0);
+    }
+}
+
+TEST_CASE("ForEachTestArchive") {
+    using namespace BoostHelpers::TestHelpers;
+
+    std::vector<TestArchive>                archives;
+
+    auto const                              func(
+        [&archives](auto traits) {
+            using Traits                    = decltype(traits);
+
+            std::ostringstream              out;
+
+            Base(10, true).Serialize<typename Traits::OArchive>(out);
+
+            std::istringstream              in(out.str());
+
+            CHECK(Base::Deserialize<typename Traits::IArchive>(in) == Base(10, true));
+            archives.emplace_back(Traits::Archive);
+        }
+    );
+
+    ForEachTestArchive(func);
+    CHECK(archives == std::vector<TestArchive>{ TestArchive::Text, TestArchive::Xml, TestArchive::Compact, TestArchive::Binary });
+
+    archives.clear();
+
+    ForEachTestArchive<TestArchive::Binary, TestArchive::Columns>(func);
+    CHECK(archives == std::vector<TestArchive>{ TestArchive::Binary, TestArchive::Columns });
+}
+
 SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Base);
 SERIALIZATION_POLYMORPHIC_DECLARE_AND_DEFINE(Derived);
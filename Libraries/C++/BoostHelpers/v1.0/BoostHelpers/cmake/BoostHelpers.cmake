@@ -21,8 +21,16 @@ function(Impl)
             ON
 
         FILES
+            ${_this_path}/../ArchiveSession.h
+            ${_this_path}/../AsyncSerialization.h
+            ${_this_path}/../ChunkedSerialization.h
+            ${_this_path}/../CompactArchive.h
             ${_this_path}/../Serialization.h
             ${_this_path}/../Serialization.suffix.h
+            ${_this_path}/../SerializationStats.h
+            ${_this_path}/../SerializeColumns.h
+            ${_this_path}/../SerializeRange.h
+            ${_this_path}/../StreamReader.h
             ${_this_path}/../TestHelpers.h
 
         PUBLIC_INCLUDE_DIRECTORIES
@@ -31,6 +39,58 @@ function(Impl)
         PUBLIC_LINK_LIBRARIES
             BoostCommon
     )
+
+    # MappedReader.h and CompressedSerialization.h require compiled libraries
+    # (Boost.Iostreams, along with zlib and zstd for the compression filters),
+    # so they are provided by separate targets that are only defined when those
+    # libraries are available. Code that only includes Serialization.h does not
+    # link against them.
+    find_package(Boost QUIET COMPONENTS iostreams)
+
+    if(NOT TARGET Boost::iostreams)
+        message(STATUS "Boost.Iostreams was not found; BoostHelpers_MappedReader and BoostHelpers_Compression will not be available")
+        return()
+    endif()
+
+    build_library(
+        NAME
+            BoostHelpers_MappedReader
+
+        IS_INTERFACE
+            ON
+
+        FILES
+            ${_this_path}/../MappedReader.h
+
+        PUBLIC_LINK_LIBRARIES
+            BoostHelpers
+            Boost::iostreams
+    )
+
+    find_package(ZLIB QUIET)
+    find_library(BoostHelpers_ZSTD_LIBRARY NAMES zstd zstd_static libzstd libzstd_static)
+
+    if(NOT TARGET ZLIB::ZLIB OR NOT BoostHelpers_ZSTD_LIBRARY)
+        message(STATUS "zlib or zstd was not found; BoostHelpers_Compression will not be available")
+        return()
+    endif()
+
+    build_library(
+        NAME
+            BoostHelpers_Compression
+
+        IS_INTERFACE
+            ON
+
+        FILES
+            ${_this_path}/../CompressedSerialization.h
+
+        PUBLIC_LINK_LIBRARIES
+            BoostHelpers
+            Boost::iostreams
+            ZLIB::ZLIB
+            ${BoostHelpers_ZSTD_LIBRARY}
+    )
 endfunction()
 
 Impl()